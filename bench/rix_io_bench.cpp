@@ -0,0 +1,263 @@
+/**
+ * @file rix_io_bench.cpp
+ * @brief Throughput benchmarks for the io module backends.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ *
+ * Usage: rix_io_bench [runs] [filter]
+ *
+ * Each case runs `runs` times (default 5) and reports the best time, so page
+ * cache warm-up does not skew the first backend measured. Files live under
+ * the temp directory and are removed on exit. With a `filter`, only cases
+ * whose name contains it are run.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <rix/io/async.hpp>
+#include <rix/io/async_file.hpp>
+#include <rix/io/buffer.hpp>
+#include <rix/io/buffered_writer.hpp>
+#include <rix/io/file.hpp>
+#include <rix/io/io_stats.hpp>
+#include <rix/io/mapped_file.hpp>
+#include <rix/io/reader.hpp>
+#include <rix/io/task.hpp>
+#include <rix/io/util.hpp>
+#include <rix/io/writer.hpp>
+
+namespace fs = std::filesystem;
+using namespace rix::io;
+
+namespace
+{
+  constexpr std::size_t small_size = 4 * 1024;
+  constexpr std::size_t huge_size = 32 * 1024 * 1024;
+
+  struct Config
+  {
+    int runs{5};
+    std::string_view filter{};
+  };
+
+  volatile std::size_t sink = 0;
+
+  /**
+   * @brief Run `fn` `cfg.runs` times and print the best time and throughput.
+   *
+   * `bytes` is the amount of data one call moves, used for the MB/s column.
+   */
+  void run_case(const Config &cfg, std::string_view name, std::size_t bytes, const std::function<std::size_t()> &fn)
+  {
+    if (!cfg.filter.empty() && name.find(cfg.filter) == std::string_view::npos)
+    {
+      return;
+    }
+
+    // Small files are too fast for one call to be timed meaningfully.
+    const std::size_t reps = bytes < (1u << 20) ? 256 : 1;
+
+    std::chrono::nanoseconds best = std::chrono::nanoseconds::max();
+    for (int r = 0; r < cfg.runs; ++r)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < reps; ++i)
+      {
+        sink = sink + fn();
+      }
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+
+    const double ns_per_op = static_cast<double>(best.count()) / static_cast<double>(reps);
+    const double mb_per_s = ns_per_op > 0.0 ? static_cast<double>(bytes) * 1e3 / ns_per_op : 0.0;
+    std::printf("%-40s %14.0f ns/op %10.1f MB/s\n", std::string(name).c_str(), ns_per_op, mb_per_s);
+  }
+
+  std::string make_text(std::size_t size)
+  {
+    std::string out;
+    out.reserve(size);
+    while (out.size() < size)
+    {
+      out += "the quick brown fox jumps over the lazy dog 0123456789\n";
+    }
+    out.resize(size);
+    return out;
+  }
+
+  std::vector<std::byte> make_binary(std::size_t size)
+  {
+    std::vector<std::byte> out(size);
+    std::uint64_t x = 0x9e3779b97f4a7c15ull;
+    for (auto &b : out)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      b = static_cast<std::byte>(x);
+    }
+    return out;
+  }
+
+  std::size_t read_text(const fs::path &p, FileBackend backend)
+  {
+    File f{p, FileMode::read, FileType::text, backend};
+    return f.read_all_text().size();
+  }
+
+  std::size_t read_bytes(const fs::path &p, FileBackend backend)
+  {
+    File f{p, FileMode::read, FileType::binary, backend};
+    return f.read_all_bytes().size();
+  }
+
+  // Mapping alone is free; fault in every page so the comparison is fair.
+  std::size_t touch_mapped(const fs::path &p)
+  {
+    const MappedFile m = read_file_mapped(p);
+    std::size_t acc = 0;
+    for (std::size_t off = 0; off < m.size(); off += 4096)
+    {
+      acc += static_cast<std::size_t>(m.data()[off]);
+    }
+    return m.size() + (acc & 1u);
+  }
+
+  void read_benchmarks(const Config &cfg, AsyncIoContext &ctx, std::string_view label, const fs::path &text,
+                       const fs::path &binary, std::size_t size)
+  {
+    const std::string t(label);
+
+    run_case(cfg, "read_text/" + t + "/stream", size, [&]
+             { return read_text(text, FileBackend::stream); });
+    run_case(cfg, "read_text/" + t + "/native", size, [&]
+             { return read_text(text, FileBackend::native); });
+    run_case(cfg, "read_bytes/" + t + "/stream", size, [&]
+             { return read_bytes(binary, FileBackend::stream); });
+    run_case(cfg, "read_bytes/" + t + "/native", size, [&]
+             { return read_bytes(binary, FileBackend::native); });
+    run_case(cfg, "read_bytes/" + t + "/mmap", size, [&]
+             { return touch_mapped(binary); });
+    run_case(cfg, "read_bytes/" + t + "/async", size, [&]
+             { return sync_wait(async_read_file_binary(ctx, binary)).size(); });
+  }
+
+  void write_benchmarks(const Config &cfg, std::string_view label, const fs::path &out, std::size_t size)
+  {
+    const std::string t(label);
+    const auto data = make_binary(size);
+
+    run_case(cfg, "write_bytes/" + t + "/stream", size, [&]
+             {
+               File f{out, FileMode::write, FileType::binary, FileBackend::stream};
+               f.write(std::span<const std::byte>(data));
+               return data.size(); });
+    run_case(cfg, "write_bytes/" + t + "/native", size, [&]
+             {
+               write_file_binary(out, data);
+               return data.size(); });
+    run_case(cfg, "write_bytes/" + t + "/buffered_64b", size, [&]
+             {
+               BufferedWriter w{out};
+               for (std::size_t off = 0; off < data.size(); off += 64)
+               {
+                 w.write(std::span<const std::byte>(data).subspan(off, std::min<std::size_t>(64, data.size() - off)));
+               }
+               w.flush();
+               return data.size(); });
+  }
+
+  void buffer_benchmarks(const Config &cfg)
+  {
+    run_case(cfg, "buffer_append/16b_x64k", 16 * 65536, []
+             {
+               Buffer buf;
+               const std::string_view piece{"0123456789abcdef"};
+               for (int i = 0; i < 65536; ++i)
+               {
+                 buf.append(piece);
+               }
+               return buf.size(); });
+  }
+
+  void print_stats(const IoStatsSnapshot &s)
+  {
+    auto line = [](const char *name, const IoOpStats &op)
+    {
+      const double avg = op.calls != 0 ? static_cast<double>(op.total_ns) / static_cast<double>(op.calls) : 0.0;
+      std::printf("  %-6s calls=%-10llu errors=%-4llu bytes=%-14llu avg=%.0f ns\n", name,
+                  static_cast<unsigned long long>(op.calls), static_cast<unsigned long long>(op.errors),
+                  static_cast<unsigned long long>(op.bytes), avg);
+    };
+
+    std::printf("\nio stats (native and io_uring paths only):\n");
+    line("open", s.open);
+    line("read", s.read);
+    line("write", s.write);
+    line("sync", s.sync);
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  Config cfg;
+  if (argc > 1)
+  {
+    cfg.runs = std::max(1, std::atoi(argv[1]));
+  }
+  if (argc > 2)
+  {
+    cfg.filter = argv[2];
+  }
+
+  const fs::path small_text = temp_path("rix_io_bench_small_txt");
+  const fs::path small_bin = temp_path("rix_io_bench_small_bin");
+  const fs::path huge_text = temp_path("rix_io_bench_huge_txt");
+  const fs::path huge_bin = temp_path("rix_io_bench_huge_bin");
+  const fs::path out = temp_path("rix_io_bench_out");
+
+  write_file_text(small_text, make_text(small_size));
+  write_file_binary(small_bin, make_binary(small_size));
+  write_file_text(huge_text, make_text(huge_size));
+  write_file_binary(huge_bin, make_binary(huge_size));
+
+  set_io_stats_callback(print_stats);
+  set_io_stats_enabled(true);
+  reset_io_stats();
+
+  {
+    AsyncIoContext ctx;
+    std::printf("async backend: %s\n\n", ctx.backend() == AsyncBackend::io_uring ? "io_uring" : "thread_pool");
+
+    read_benchmarks(cfg, ctx, "4k", small_text, small_bin, small_size);
+    read_benchmarks(cfg, ctx, "32m", huge_text, huge_bin, huge_size);
+  }
+  write_benchmarks(cfg, "4k", out, small_size);
+  write_benchmarks(cfg, "32m", out, huge_size);
+  buffer_benchmarks(cfg);
+
+  set_io_stats_enabled(false);
+  publish_io_stats();
+
+  std::error_code ec;
+  for (const auto &p : {small_text, small_bin, huge_text, huge_bin, out})
+  {
+    fs::remove(p, ec);
+  }
+  return 0;
+}
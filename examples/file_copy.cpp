@@ -1,9 +1,7 @@
 #include <cassert>
 #include <filesystem>
 #include <iostream>
-#include <span>
 #include <string>
-#include <vector>
 
 #include <rix/io/reader.hpp>
 #include <rix/io/util.hpp>
@@ -21,12 +19,16 @@ static int run_example()
 
   const std::string content =
       "Rix IO copy example\n"
-      "This file will be copied as bytes.\n";
+      "This file will be copied without passing through userspace where possible.\n";
 
   write_file_text(src, content);
 
-  const std::vector<std::byte> bytes = read_file_binary(src);
-  write_file_binary(dst, std::span<const std::byte>(bytes.data(), bytes.size()));
+  const auto copied = path_copy(src, dst);
+  if (copied != content.size())
+  {
+    std::cerr << "[io] Copied " << copied << " of " << content.size() << " bytes\n";
+    return 1;
+  }
 
   const auto out = read_file_text(dst);
   assert(out == content);
@@ -0,0 +1,45 @@
+/**
+ * @file access_pattern.hpp
+ * @brief Access-pattern hints shared by `File::advise()` and `MappedFile::advise()`.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_ACCESS_PATTERN_HPP
+#define RIX_IO_ACCESS_PATTERN_HPP
+
+namespace rix::io
+{
+  /**
+   * @brief How a range of a file is about to be accessed.
+   *
+   * Hints are best-effort: the OS may ignore them, and unsupported hints
+   * are reported by `advise()` returning false rather than by an error.
+   *
+   * | Pattern      | `posix_fadvise`        | `madvise`         |
+   * |--------------|------------------------|-------------------|
+   * | `normal`     | `POSIX_FADV_NORMAL`    | `MADV_NORMAL`     |
+   * | `sequential` | `POSIX_FADV_SEQUENTIAL`| `MADV_SEQUENTIAL` |
+   * | `random`     | `POSIX_FADV_RANDOM`    | `MADV_RANDOM`     |
+   * | `will_need`  | `POSIX_FADV_WILLNEED`  | `MADV_WILLNEED`   |
+   * | `dont_need`  | `POSIX_FADV_DONTNEED`  | `MADV_DONTNEED`   |
+   * | `no_reuse`   | `POSIX_FADV_NOREUSE`   | `MADV_COLD`       |
+   * | `huge_pages` | -                      | `MADV_HUGEPAGE`   |
+   */
+  enum class AccessPattern
+  {
+    normal,
+    sequential,
+    random,
+    will_need,
+    dont_need,
+    no_reuse,
+    huge_pages
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_ACCESS_PATTERN_HPP
@@ -0,0 +1,986 @@
+/**
+ * @file async.hpp
+ * @brief Asynchronous positional file I/O with io_uring and thread-pool backends.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_ASYNC_HPP
+#define RIX_IO_ASYNC_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <rix/io/file.hpp>
+#include <rix/io/io_stats.hpp>
+#include <rix/io/thread_pool.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>) && !defined(RIX_IO_NO_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define RIX_IO_HAS_IO_URING 1
+#endif
+#endif
+
+#ifndef RIX_IO_HAS_IO_URING
+#define RIX_IO_HAS_IO_URING 0
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Engine used by `AsyncIoContext`.
+   *
+   * - `automatic`: io_uring when the kernel allows it, thread pool otherwise
+   * - `io_uring`: Linux io_uring (fails if unavailable)
+   * - `thread_pool`: blocking positional I/O on worker threads (portable)
+   */
+  enum class AsyncBackend
+  {
+    automatic,
+    io_uring,
+    thread_pool
+  };
+
+  /**
+   * @brief Options for `AsyncIoContext`.
+   */
+  struct AsyncIoOptions
+  {
+    AsyncBackend backend{AsyncBackend::automatic};
+
+    /**
+     * @brief io_uring submission queue size (rounded up to a power of two by the kernel).
+     */
+    unsigned queue_depth{256};
+
+    /**
+     * @brief Worker count for the thread-pool backend (hardware concurrency if 0).
+     */
+    std::size_t threads{0};
+  };
+
+  class AsyncIoContext;
+
+  namespace detail
+  {
+    /**
+     * @brief Shared state of one in-flight read or write.
+     */
+    struct IoOperation
+    {
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::coroutine_handle<> waiter{};
+      std::size_t transferred{0};
+      std::error_code error{};
+      bool done{false};
+
+      File *file{nullptr};
+      native_handle_type handle{};
+      std::byte *data{nullptr};
+      std::size_t size{0};
+      std::uint64_t offset{0};
+      bool write{false};
+
+#if RIX_IO_HAS_IO_URING
+      ::iovec iov{};
+      std::shared_ptr<IoOperation> keep_alive{};
+
+      // Links in the context's list of operations owned by the kernel.
+      IoOperation *prev_live{nullptr};
+      IoOperation *next_live{nullptr};
+
+      // Set only while I/O stats are enabled.
+      std::chrono::steady_clock::time_point submitted{};
+#endif
+
+      /**
+       * @brief Publish the result, wake blocked waiters and resume an awaiting coroutine.
+       */
+      void complete(std::size_t n, std::error_code ec) noexcept
+      {
+        std::coroutine_handle<> h;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          transferred = n;
+          error = ec;
+          done = true;
+          h = std::exchange(waiter, {});
+        }
+        cv.notify_all();
+
+        if (h)
+        {
+          h.resume();
+        }
+      }
+    };
+  } // namespace detail
+
+  /**
+   * @brief Completion handle of an asynchronous operation.
+   *
+   * Usable both as a future (`wait()`, `get()`) and as a C++20 awaitable:
+   * `std::size_t n = co_await ctx.read_at(file, 0, buf);`
+   *
+   * An awaiting coroutine is resumed on the engine's completion thread.
+   */
+  class IoFuture
+  {
+  public:
+    IoFuture() = default;
+
+    [[nodiscard]] bool valid() const noexcept { return op_ != nullptr; }
+
+    /**
+     * @brief Whether the operation has completed.
+     */
+    [[nodiscard]] bool ready() const
+    {
+      require_valid();
+      std::lock_guard<std::mutex> lock(op_->mutex);
+      return op_->done;
+    }
+
+    /**
+     * @brief Block until the operation completes.
+     */
+    void wait() const
+    {
+      require_valid();
+      std::unique_lock<std::mutex> lock(op_->mutex);
+      op_->cv.wait(lock, [this]
+                   { return op_->done; });
+    }
+
+    /**
+     * @brief Wait and return the number of bytes transferred.
+     *
+     * Reads are short only at end of file.
+     *
+     * @throws std::system_error if the operation failed.
+     */
+    [[nodiscard]] std::size_t get() const
+    {
+      wait();
+      if (op_->error)
+      {
+        throw std::system_error(op_->error, "rix::io::IoFuture: operation failed");
+      }
+      return op_->transferred;
+    }
+
+    [[nodiscard]] bool await_ready() const { return ready(); }
+
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> h) const
+    {
+      std::lock_guard<std::mutex> lock(op_->mutex);
+      if (op_->done)
+      {
+        return false;
+      }
+      op_->waiter = h;
+      return true;
+    }
+
+    [[nodiscard]] std::size_t await_resume() const { return get(); }
+
+  private:
+    friend class AsyncIoContext;
+
+    std::shared_ptr<detail::IoOperation> op_{};
+
+    explicit IoFuture(std::shared_ptr<detail::IoOperation> op) noexcept
+        : op_(std::move(op))
+    {
+    }
+
+    void require_valid() const
+    {
+      if (!op_)
+      {
+        throw std::logic_error("rix::io::IoFuture: no associated operation");
+      }
+    }
+  };
+
+  /**
+   * @brief Asynchronous engine for positional reads and writes on native files.
+   *
+   * On Linux, operations are submitted to an io_uring instance set up with
+   * raw system calls (no liburing dependency); a dedicated thread reaps
+   * completions. Elsewhere, or when io_uring is unavailable or disabled
+   * (`RIX_IO_NO_IO_URING`), operations run as blocking `File::read_at()` /
+   * `File::write_at()` calls on a `ThreadPool`. Windows uses the thread pool
+   * because `File` handles are not opened for overlapped I/O.
+   *
+   * Files and buffers must stay alive until the operation completes.
+   * The destructor waits for every in-flight operation.
+   *
+   * If waiting on the io_uring instance fails, every outstanding operation
+   * completes with that error and so does every later submission.
+   */
+  class AsyncIoContext
+  {
+  public:
+    /**
+     * @brief Group of operations submitted together.
+     *
+     * With io_uring, `submit()` hands every queued operation to the kernel
+     * with a single `io_uring_enter` call. Unsubmitted operations are
+     * submitted by the destructor.
+     */
+    class Batch
+    {
+    public:
+      explicit Batch(AsyncIoContext &ctx) noexcept
+          : ctx_(&ctx)
+      {
+      }
+
+      ~Batch() noexcept
+      {
+        try
+        {
+          submit();
+        }
+        catch (...)
+        {
+        }
+      }
+
+      Batch(const Batch &) = delete;
+      Batch &operator=(const Batch &) = delete;
+
+      /**
+       * @brief Queue a positional read.
+       *
+       * @throws std::invalid_argument if `file` is not an open, readable, native file.
+       */
+      [[nodiscard]] IoFuture read_at(File &file, std::uint64_t offset, std::span<std::byte> out)
+      {
+        auto op = make_operation(file, offset, out.data(), out.size(), false);
+        ops_.push_back(op);
+        return IoFuture(std::move(op));
+      }
+
+      /**
+       * @brief Queue a positional write.
+       *
+       * @throws std::invalid_argument if `file` is not an open, writable, native file.
+       */
+      [[nodiscard]] IoFuture write_at(File &file, std::uint64_t offset, std::span<const std::byte> bytes)
+      {
+        auto op = make_operation(file, offset, const_cast<std::byte *>(bytes.data()), bytes.size(), true);
+        ops_.push_back(op);
+        return IoFuture(std::move(op));
+      }
+
+      /**
+       * @brief Submit every queued operation.
+       */
+      void submit()
+      {
+        if (ops_.empty())
+        {
+          return;
+        }
+
+        auto ops = std::move(ops_);
+        ops_.clear();
+        ctx_->submit(ops);
+      }
+
+      [[nodiscard]] std::size_t size() const noexcept { return ops_.size(); }
+
+    private:
+      AsyncIoContext *ctx_;
+      std::vector<std::shared_ptr<detail::IoOperation>> ops_;
+    };
+
+    /**
+     * @brief Start the engine.
+     *
+     * @throws std::system_error if `AsyncBackend::io_uring` is requested and cannot be set up.
+     */
+    explicit AsyncIoContext(AsyncIoOptions options = {})
+    {
+      if (options.backend != AsyncBackend::thread_pool)
+      {
+        std::error_code ec;
+        if (uring_start(options.queue_depth, ec))
+        {
+          backend_ = AsyncBackend::io_uring;
+          return;
+        }
+
+        if (options.backend == AsyncBackend::io_uring)
+        {
+          throw std::system_error(ec, "rix::io::AsyncIoContext: io_uring unavailable");
+        }
+      }
+
+      backend_ = AsyncBackend::thread_pool;
+      pool_.emplace(options.threads);
+    }
+
+    /**
+     * @brief Wait for in-flight operations and stop the engine.
+     */
+    ~AsyncIoContext() noexcept
+    {
+      if (backend_ == AsyncBackend::io_uring)
+      {
+        uring_stop();
+      }
+      else
+      {
+        pool_.reset();
+      }
+    }
+
+    AsyncIoContext(const AsyncIoContext &) = delete;
+    AsyncIoContext &operator=(const AsyncIoContext &) = delete;
+
+    /**
+     * @brief Backend actually in use (never `automatic`).
+     */
+    [[nodiscard]] AsyncBackend backend() const noexcept { return backend_; }
+
+    /**
+     * @brief Start a positional read of up to `out.size()` bytes.
+     *
+     * @throws std::invalid_argument if `file` is not an open, readable, native file.
+     */
+    [[nodiscard]] IoFuture read_at(File &file, std::uint64_t offset, std::span<std::byte> out)
+    {
+      Batch b{*this};
+      auto f = b.read_at(file, offset, out);
+      b.submit();
+      return f;
+    }
+
+    /**
+     * @brief Start a positional write of all of `bytes`.
+     *
+     * @throws std::invalid_argument if `file` is not an open, writable, native file.
+     */
+    [[nodiscard]] IoFuture write_at(File &file, std::uint64_t offset, std::span<const std::byte> bytes)
+    {
+      Batch b{*this};
+      auto f = b.write_at(file, offset, bytes);
+      b.submit();
+      return f;
+    }
+
+    /**
+     * @brief Create a batch of operations submitted together.
+     */
+    [[nodiscard]] Batch batch() noexcept { return Batch{*this}; }
+
+  private:
+    using op_ptr = std::shared_ptr<detail::IoOperation>;
+
+    AsyncBackend backend_{AsyncBackend::thread_pool};
+    std::optional<ThreadPool> pool_{};
+
+    [[nodiscard]] static op_ptr make_operation(File &file, std::uint64_t offset, std::byte *data, std::size_t size, bool write)
+    {
+      const bool allowed = write ? detail::mode_can_write(file.mode()) : detail::mode_can_read(file.mode());
+      if (!file.is_open() || file.backend() != FileBackend::native || !allowed)
+      {
+        throw std::invalid_argument(write
+                                        ? "rix::io::AsyncIoContext: write requires an open writable native file"
+                                        : "rix::io::AsyncIoContext: read requires an open readable native file");
+      }
+
+      auto op = std::make_shared<detail::IoOperation>();
+      op->file = &file;
+      op->handle = file.native_handle();
+      op->data = data;
+      op->size = size;
+      op->offset = offset;
+      op->write = write;
+      return op;
+    }
+
+    void submit(std::vector<op_ptr> &ops)
+    {
+      if (backend_ == AsyncBackend::io_uring)
+      {
+        uring_submit(ops);
+        return;
+      }
+
+      for (auto &op : ops)
+      {
+        pool_->post([op]
+                    { run_blocking(*op); });
+      }
+    }
+
+    static void run_blocking(detail::IoOperation &op) noexcept
+    {
+      std::size_t n = 0;
+      std::error_code ec;
+
+      try
+      {
+        if (op.write)
+        {
+          op.file->write_at(op.offset, std::span<const std::byte>(op.data, op.size));
+          n = op.size;
+        }
+        else
+        {
+          n = op.file->read_at(op.offset, std::span<std::byte>(op.data, op.size));
+        }
+      }
+      catch (const std::system_error &e)
+      {
+        ec = e.code();
+      }
+      catch (...)
+      {
+        ec = std::make_error_code(std::errc::io_error);
+      }
+
+      op.complete(n, ec);
+    }
+
+#if RIX_IO_HAS_IO_URING
+    int ring_fd_{-1};
+    void *sq_ring_{nullptr};
+    void *cq_ring_{nullptr};
+    std::size_t sq_ring_size_{0};
+    std::size_t cq_ring_size_{0};
+    ::io_uring_sqe *sqes_{nullptr};
+    std::size_t sqes_size_{0};
+
+    unsigned *sq_head_{nullptr};
+    unsigned *sq_tail_{nullptr};
+    unsigned *sq_array_{nullptr};
+    unsigned sq_mask_{0};
+    unsigned sq_entries_{0};
+
+    unsigned *cq_head_{nullptr};
+    unsigned *cq_tail_{nullptr};
+    ::io_uring_cqe *cqes_{nullptr};
+    unsigned cq_mask_{0};
+    unsigned cq_entries_{0};
+
+    std::mutex mutex_;
+    std::condition_variable slots_cv_;
+    std::size_t in_flight_{0};
+    detail::IoOperation *live_{nullptr};
+    std::thread reaper_;
+
+    // Set by the reaper when the ring fails; every later submission fails with it.
+    std::error_code broken_{};
+
+    static constexpr std::uint64_t stop_token = 0;
+
+    [[nodiscard]] static unsigned load_acquire(unsigned *p) noexcept
+    {
+      return std::atomic_ref<unsigned>(*p).load(std::memory_order_acquire);
+    }
+
+    static void store_release(unsigned *p, unsigned v) noexcept
+    {
+      std::atomic_ref<unsigned>(*p).store(v, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool uring_start(unsigned depth, std::error_code &ec) noexcept
+    {
+      ::io_uring_params params{};
+      const long fd = ::syscall(__NR_io_uring_setup, depth == 0 ? 1u : depth, &params);
+      if (fd < 0)
+      {
+        ec = detail::last_os_error();
+        return false;
+      }
+      ring_fd_ = static_cast<int>(fd);
+
+      sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+
+      const bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+      if (single)
+      {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+      }
+
+      sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+      if (sq_ring_ == MAP_FAILED)
+      {
+        ec = detail::last_os_error();
+        sq_ring_ = nullptr;
+        uring_release();
+        return false;
+      }
+
+      if (single)
+      {
+        cq_ring_ = sq_ring_;
+      }
+      else
+      {
+        cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED)
+        {
+          ec = detail::last_os_error();
+          cq_ring_ = nullptr;
+          uring_release();
+          return false;
+        }
+      }
+
+      sqes_size_ = params.sq_entries * sizeof(::io_uring_sqe);
+      void *sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+      if (sqes == MAP_FAILED)
+      {
+        ec = detail::last_os_error();
+        uring_release();
+        return false;
+      }
+      sqes_ = static_cast<::io_uring_sqe *>(sqes);
+
+      auto *sq = static_cast<char *>(sq_ring_);
+      sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+      sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+      sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+      sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+      sq_entries_ = params.sq_entries;
+
+      auto *cq = static_cast<char *>(cq_ring_);
+      cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+      cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+      cqes_ = reinterpret_cast<::io_uring_cqe *>(cq + params.cq_off.cqes);
+      cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+      cq_entries_ = params.cq_entries;
+
+      try
+      {
+        reaper_ = std::thread([this]
+                              { reap(); });
+      }
+      catch (const std::system_error &e)
+      {
+        ec = e.code();
+        uring_release();
+        return false;
+      }
+
+      return true;
+    }
+
+    void uring_release() noexcept
+    {
+      if (sqes_ != nullptr)
+      {
+        ::munmap(sqes_, sqes_size_);
+        sqes_ = nullptr;
+      }
+      if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+      {
+        ::munmap(cq_ring_, cq_ring_size_);
+      }
+      cq_ring_ = nullptr;
+      if (sq_ring_ != nullptr)
+      {
+        ::munmap(sq_ring_, sq_ring_size_);
+        sq_ring_ = nullptr;
+      }
+      if (ring_fd_ >= 0)
+      {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+      }
+    }
+
+    void uring_stop() noexcept
+    {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        slots_cv_.wait(lock, [this]
+                       { return in_flight_ == 0; });
+
+        // A NOP tagged with `stop_token` tells the reaper to exit, unless
+        // it already has after a ring failure.
+        if (!broken_)
+        {
+          ::io_uring_sqe &sqe = next_sqe();
+          sqe.opcode = IORING_OP_NOP;
+          sqe.user_data = stop_token;
+          publish_sqe();
+
+          std::vector<op_ptr> none;
+          (void)enter(1, none);
+        }
+      }
+
+      if (reaper_.joinable())
+      {
+        reaper_.join();
+      }
+      uring_release();
+    }
+
+    /**
+     * @brief Reserve the next SQE slot (caller holds `mutex_` and ensured room).
+     */
+    [[nodiscard]] ::io_uring_sqe &next_sqe() noexcept
+    {
+      const unsigned tail = *sq_tail_;
+      ::io_uring_sqe &sqe = sqes_[tail & sq_mask_];
+      std::memset(&sqe, 0, sizeof(sqe));
+      return sqe;
+    }
+
+    void publish_sqe() noexcept
+    {
+      const unsigned tail = *sq_tail_;
+      sq_array_[tail & sq_mask_] = tail & sq_mask_;
+      store_release(sq_tail_, tail + 1);
+    }
+
+    /**
+     * @brief Track `op` as owned by the kernel (caller holds `mutex_`).
+     */
+    void link_live(detail::IoOperation &op) noexcept
+    {
+      op.prev_live = nullptr;
+      op.next_live = live_;
+      if (live_ != nullptr)
+      {
+        live_->prev_live = &op;
+      }
+      live_ = &op;
+      ++in_flight_;
+    }
+
+    void unlink_live(detail::IoOperation &op) noexcept
+    {
+      if (op.prev_live != nullptr)
+      {
+        op.prev_live->next_live = op.next_live;
+      }
+      else
+      {
+        live_ = op.next_live;
+      }
+      if (op.next_live != nullptr)
+      {
+        op.next_live->prev_live = op.prev_live;
+      }
+      op.prev_live = op.next_live = nullptr;
+      --in_flight_;
+    }
+
+    void prepare(detail::IoOperation &op) noexcept
+    {
+      op.iov.iov_base = op.data + op.transferred;
+      op.iov.iov_len = op.size - op.transferred;
+      if (io_stats_enabled())
+      {
+        op.submitted = std::chrono::steady_clock::now();
+      }
+
+      ::io_uring_sqe &sqe = next_sqe();
+      sqe.opcode = op.write ? IORING_OP_WRITEV : IORING_OP_READV;
+      sqe.fd = op.handle;
+      sqe.addr = reinterpret_cast<std::uint64_t>(&op.iov);
+      sqe.len = 1;
+      sqe.off = op.offset + op.transferred;
+      sqe.user_data = reinterpret_cast<std::uint64_t>(&op);
+      publish_sqe();
+    }
+
+    /**
+     * @brief Hand `count` published SQEs to the kernel (caller holds `mutex_`).
+     *
+     * `pushed` lists the operations behind those SQEs, in order. If the
+     * kernel refuses them, they are withdrawn from the ring and returned
+     * so the caller can fail them outside the lock.
+     */
+    [[nodiscard]] std::error_code enter(unsigned count, std::vector<op_ptr> &pushed) noexcept
+    {
+      // Keep only the operations behind the `count` SQEs not yet consumed.
+      const auto keep_tail = [&pushed](unsigned n)
+      {
+        const auto keep = std::min<std::size_t>(n, pushed.size());
+        pushed.erase(pushed.begin(), pushed.end() - static_cast<std::ptrdiff_t>(keep));
+      };
+
+      while (count != 0)
+      {
+        const long r = ::syscall(__NR_io_uring_enter, ring_fd_, count, 0u, 0u, nullptr, 0u);
+        if (r >= 0)
+        {
+          count -= static_cast<unsigned>(r);
+          keep_tail(count);
+          continue;
+        }
+
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        const std::error_code ec = detail::last_os_error();
+        store_release(sq_tail_, *sq_tail_ - count);
+        keep_tail(count);
+        return ec;
+      }
+
+      pushed.clear();
+      return {};
+    }
+
+    void uring_submit(std::vector<op_ptr> &ops)
+    {
+      std::vector<op_ptr> failed;
+      std::error_code failure;
+
+      {
+        const bool on_reaper = (std::this_thread::get_id() == reaper_.get_id());
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::vector<op_ptr> pushed;
+        unsigned pending = 0;
+
+        const auto flush = [&]
+        {
+          if (const auto ec = enter(pending, pushed))
+          {
+            failure = ec;
+            for (auto &op : pushed)
+            {
+              unlink_live(*op);
+            }
+            failed.insert(failed.end(), pushed.begin(), pushed.end());
+            pushed.clear();
+          }
+          pending = 0;
+        };
+
+        for (auto &op : ops)
+        {
+          if (broken_)
+          {
+            failure = broken_;
+            failed.push_back(op);
+            continue;
+          }
+
+          // Bound in-flight work by the completion queue so it never overflows.
+          // The reaper itself (a resumed coroutine submitting more work) must
+          // not wait for completions only it can process.
+          if (in_flight_ >= cq_entries_ || pending == sq_entries_)
+          {
+            flush();
+          }
+          slots_cv_.wait(lock, [this, on_reaper]
+                         { return on_reaper || broken_ || in_flight_ < cq_entries_; });
+          if (broken_)
+          {
+            failure = broken_;
+            failed.push_back(op);
+            continue;
+          }
+
+          op->keep_alive = op;
+          prepare(*op);
+          pushed.push_back(op);
+          ++pending;
+          link_live(*op);
+        }
+
+        flush();
+      }
+
+      for (auto &op : failed)
+      {
+        op->keep_alive.reset();
+        op->complete(0, failure);
+      }
+      if (!failed.empty())
+      {
+        slots_cv_.notify_all();
+      }
+    }
+
+    /**
+     * @brief Completion thread: drain the CQ, resubmit short transfers, finish operations.
+     */
+    void reap() noexcept
+    {
+      for (;;)
+      {
+        const long r = ::syscall(__NR_io_uring_enter, ring_fd_, 0u, 1u, IORING_ENTER_GETEVENTS, nullptr, 0u);
+        if (r < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+          const std::error_code ec = detail::last_os_error();
+          (void)drain_completions();
+          fail_outstanding(ec);
+          return;
+        }
+
+        if (drain_completions())
+        {
+          return;
+        }
+      }
+    }
+
+    /**
+     * @brief Process every CQE already posted; true if the stop NOP was among them.
+     */
+    [[nodiscard]] bool drain_completions() noexcept
+    {
+      unsigned head = *cq_head_;
+      const unsigned tail = load_acquire(cq_tail_);
+      bool stop = false;
+
+      while (head != tail)
+      {
+        const ::io_uring_cqe cqe = cqes_[head & cq_mask_];
+        ++head;
+        store_release(cq_head_, head);
+
+        if (cqe.user_data == stop_token)
+        {
+          stop = true;
+          continue;
+        }
+
+        on_completion(*reinterpret_cast<detail::IoOperation *>(cqe.user_data), cqe.res);
+      }
+      return stop;
+    }
+
+    /**
+     * @brief The ring can no longer be waited on: fail everything in flight
+     *        with `ec` and make later submissions fail immediately.
+     *
+     * The kernel may still own the failed requests until the ring is closed
+     * by the destructor, so their buffers should outlive the context.
+     */
+    void fail_outstanding(std::error_code ec) noexcept
+    {
+      std::vector<op_ptr> orphans;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        broken_ = ec;
+        while (live_ != nullptr)
+        {
+          detail::IoOperation &op = *live_;
+          unlink_live(op);
+          if (op.keep_alive)
+          {
+            orphans.push_back(std::move(op.keep_alive));
+          }
+        }
+      }
+
+      slots_cv_.notify_all();
+      for (auto &op : orphans)
+      {
+        op->complete(op->transferred, ec);
+      }
+    }
+
+    void on_completion(detail::IoOperation &op, int res) noexcept
+    {
+      std::error_code ec;
+      op_ptr self;
+
+      {
+        // Also orders the submitter's writes to `op` before the reads below.
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (op.submitted != std::chrono::steady_clock::time_point{})
+        {
+          const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - op.submitted)
+                              .count();
+          detail::record_io(op.write ? IoOp::write : IoOp::read,
+                            res > 0 ? static_cast<std::uint64_t>(res) : 0,
+                            res < 0,
+                            static_cast<std::uint64_t>(ns < 0 ? 0 : ns));
+          op.submitted = {};
+        }
+
+        if (res < 0)
+        {
+          ec = std::error_code(-res, std::generic_category());
+        }
+        else
+        {
+          op.transferred += static_cast<std::size_t>(res);
+
+          const bool eof = (res == 0);
+          if (!eof && op.transferred < op.size)
+          {
+            // Short transfer: continue where it stopped, keeping the slot.
+            std::vector<op_ptr> pushed;
+            prepare(op);
+            pushed.push_back(op.keep_alive);
+            ec = enter(1, pushed);
+            if (!ec)
+            {
+              return;
+            }
+          }
+          else if (eof && op.write && op.transferred < op.size)
+          {
+            ec = std::make_error_code(std::errc::io_error);
+          }
+        }
+
+        self = std::move(op.keep_alive);
+        unlink_live(op);
+      }
+
+      slots_cv_.notify_all();
+      self->complete(self->transferred, ec);
+    }
+#else
+    [[nodiscard]] bool uring_start(unsigned, std::error_code &ec) noexcept
+    {
+      ec = std::make_error_code(std::errc::function_not_supported);
+      return false;
+    }
+
+    void uring_stop() noexcept {}
+
+    void uring_submit(std::vector<op_ptr> &) {}
+#endif
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_ASYNC_HPP
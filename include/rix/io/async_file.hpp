@@ -0,0 +1,255 @@
+/**
+ * @file async_file.hpp
+ * @brief Coroutine counterparts of the whole-file read and write helpers.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_ASYNC_FILE_HPP
+#define RIX_IO_ASYNC_FILE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <rix/io/async.hpp>
+#include <rix/io/file.hpp>
+#include <rix/io/reader.hpp>
+#include <rix/io/task.hpp>
+#include <rix/io/writer.hpp>
+
+namespace rix::io
+{
+  namespace detail
+  {
+    /**
+     * @brief Read `file` from offset 0 to end of file into `out` through `ctx`.
+     *
+     * `file.size()` is used as the size hint and `out` is sized once without
+     * zero-filling where the container allows it. Reading continues until end
+     * of file, so files with an unknown size (procfs, growing files) are read
+     * entirely; once the hint is exhausted a small probe detects EOF without
+     * growing `out`.
+     */
+    template <class Container>
+    Task<void> async_read_all(AsyncIoContext &ctx, File &file, Container &out)
+    {
+      detail::resize_for_overwrite(out, static_cast<std::size_t>(file.size()));
+
+      std::array<std::byte, 4096> probe;
+      std::size_t total = 0;
+
+      for (;;)
+      {
+        std::size_t got = 0;
+
+        if (total < out.size())
+        {
+          auto *p = reinterpret_cast<std::byte *>(out.data());
+          got = co_await ctx.read_at(file, total, std::span<std::byte>(p + total, out.size() - total));
+        }
+        else
+        {
+          got = co_await ctx.read_at(file, total, std::span<std::byte>(probe));
+          if (got != 0)
+          {
+            detail::resize_for_overwrite(out, total + got);
+            std::memcpy(reinterpret_cast<std::byte *>(out.data()) + total, probe.data(), got);
+          }
+        }
+
+        if (got == 0)
+        {
+          break;
+        }
+        total += got;
+      }
+
+      out.resize(total);
+    }
+
+    /**
+     * @brief `WriteMode::atomic_replace` through `ctx`: temporary sibling, sync, rename.
+     */
+    inline Task<void> async_write_atomic(AsyncIoContext &ctx,
+                                         std::filesystem::path target,
+                                         std::span<const std::byte> bytes,
+                                         FileType type)
+    {
+      std::filesystem::path tmp;
+      try
+      {
+        File file = create_atomic_sibling(target, type);
+        tmp = file.path();
+        if (!bytes.empty())
+        {
+          (void)co_await ctx.write_at(file, 0, bytes);
+        }
+        file.sync_data();
+      }
+      catch (...)
+      {
+        if (!tmp.empty())
+        {
+          std::error_code ignore;
+          std::filesystem::remove(tmp, ignore);
+        }
+        throw;
+      }
+
+      commit_atomic(tmp, target, AtomicWriteOptions{});
+    }
+
+    inline Task<void> async_write_all(AsyncIoContext &ctx,
+                                      std::filesystem::path path,
+                                      std::span<const std::byte> bytes,
+                                      WriteMode mode,
+                                      FileType type)
+    {
+      if (mode == WriteMode::atomic_replace)
+      {
+        co_await async_write_atomic(ctx, std::move(path), bytes, type);
+        co_return;
+      }
+
+      File file{path, to_file_mode(mode), type, FileBackend::native};
+      const std::uint64_t offset = (mode == WriteMode::append) ? file.size() : 0;
+
+      if (!bytes.empty())
+      {
+        (void)co_await ctx.write_at(file, offset, bytes);
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @brief Read an entire file as bytes through an `AsyncIoContext`.
+   *
+   * The file is opened with `FileBackend::native` when the task starts; the
+   * read itself is submitted to `ctx` and the coroutine resumes on its
+   * completion thread.
+   *
+   * @throws std::system_error If opening or reading fails (rethrown on `co_await`).
+   */
+  inline Task<std::vector<std::byte>> async_read_file_binary(AsyncIoContext &ctx, std::filesystem::path path)
+  {
+    File file{path, FileMode::read, FileType::binary, FileBackend::native};
+    std::vector<std::byte> out;
+    co_await detail::async_read_all(ctx, file, out);
+    co_return out;
+  }
+
+  /**
+   * @brief Read an entire file as text through an `AsyncIoContext`.
+   *
+   * Bytes are returned as stored (no newline translation).
+   *
+   * @throws std::system_error If opening or reading fails (rethrown on `co_await`).
+   */
+  inline Task<std::string> async_read_file_text(AsyncIoContext &ctx, std::filesystem::path path)
+  {
+    File file{path, FileMode::read, FileType::text, FileBackend::native};
+    std::string out;
+    co_await detail::async_read_all(ctx, file, out);
+    co_return out;
+  }
+
+  /**
+   * @brief Write bytes to a file through an `AsyncIoContext`.
+   *
+   * `bytes` must stay valid until the task completes.
+   *
+   * @throws std::system_error If opening or writing fails (rethrown on `co_await`).
+   */
+  inline Task<void> async_write_file_binary(AsyncIoContext &ctx,
+                                            std::filesystem::path path,
+                                            std::span<const std::byte> bytes,
+                                            WriteMode mode = WriteMode::truncate)
+  {
+    return detail::async_write_all(ctx, std::move(path), bytes, mode, FileType::binary);
+  }
+
+  /**
+   * @brief Write text to a file through an `AsyncIoContext`.
+   *
+   * `text` must stay valid until the task completes. No newline translation is performed.
+   *
+   * @throws std::system_error If opening or writing fails (rethrown on `co_await`).
+   */
+  inline Task<void> async_write_file_text(AsyncIoContext &ctx,
+                                          std::filesystem::path path,
+                                          std::string_view text,
+                                          WriteMode mode = WriteMode::truncate)
+  {
+    const std::span<const std::byte> bytes(reinterpret_cast<const std::byte *>(text.data()), text.size());
+    return detail::async_write_all(ctx, std::move(path), bytes, mode, FileType::text);
+  }
+
+  /**
+   * @brief Read an entire file as bytes on a user-supplied executor.
+   *
+   * The coroutine hops onto `ex` and performs `read_file_binary()` there.
+   */
+  template <Executor E>
+  Task<std::vector<std::byte>> async_read_file_binary(E &ex, std::filesystem::path path)
+  {
+    co_await schedule_on(ex);
+    co_return read_file_binary(path);
+  }
+
+  /**
+   * @brief Read an entire file as text on a user-supplied executor.
+   *
+   * The coroutine hops onto `ex` and performs `read_file_text()` there.
+   */
+  template <Executor E>
+  Task<std::string> async_read_file_text(E &ex, std::filesystem::path path)
+  {
+    co_await schedule_on(ex);
+    co_return read_file_text(path);
+  }
+
+  /**
+   * @brief Write bytes to a file on a user-supplied executor.
+   *
+   * `bytes` must stay valid until the task completes.
+   */
+  template <Executor E>
+  Task<void> async_write_file_binary(E &ex,
+                                     std::filesystem::path path,
+                                     std::span<const std::byte> bytes,
+                                     WriteMode mode = WriteMode::truncate)
+  {
+    co_await schedule_on(ex);
+    write_file_binary(path, bytes, mode);
+  }
+
+  /**
+   * @brief Write text to a file on a user-supplied executor.
+   *
+   * `text` must stay valid until the task completes.
+   */
+  template <Executor E>
+  Task<void> async_write_file_text(E &ex,
+                                   std::filesystem::path path,
+                                   std::string_view text,
+                                   WriteMode mode = WriteMode::truncate)
+  {
+    co_await schedule_on(ex);
+    write_file_text(path, text, mode);
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_ASYNC_FILE_HPP
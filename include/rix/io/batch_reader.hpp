@@ -0,0 +1,164 @@
+/**
+ * @file batch_reader.hpp
+ * @brief Load many files concurrently with per-file, non-throwing results.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_BATCH_READER_HPP
+#define RIX_IO_BATCH_READER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <latch>
+#include <new>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include <rix/io/file.hpp>
+#include <rix/io/thread_pool.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Outcome of reading one file in a batch.
+   */
+  struct FileReadResult
+  {
+    std::vector<std::byte> bytes{};
+    std::error_code error{};
+
+    [[nodiscard]] bool ok() const noexcept { return !error; }
+
+    explicit operator bool() const noexcept { return ok(); }
+  };
+
+  /**
+   * @brief Options for `read_files_binary()`.
+   */
+  struct BatchReadOptions
+  {
+    /**
+     * @brief Maximum number of concurrent readers (hardware concurrency if 0).
+     */
+    std::size_t threads{0};
+  };
+
+  namespace detail
+  {
+    inline void read_one_into(const std::filesystem::path &path, FileReadResult &out) noexcept
+    {
+      try
+      {
+        File f{path, FileMode::read, FileType::binary, FileBackend::native};
+        out.bytes = f.read_all_bytes();
+      }
+      catch (const std::system_error &e)
+      {
+        out.error = e.code();
+      }
+      catch (const std::bad_alloc &)
+      {
+        out.error = std::make_error_code(std::errc::not_enough_memory);
+      }
+      catch (...)
+      {
+        out.error = std::make_error_code(std::errc::io_error);
+      }
+    }
+
+    /**
+     * @brief Run `workers` copies of a loop that claims the next unread path.
+     *
+     * Claiming through a shared atomic cursor balances uneven file sizes the
+     * same way work stealing would, without per-worker queues.
+     */
+    inline void read_batch_on(ThreadPool &pool,
+                              std::span<const std::filesystem::path> paths,
+                              std::vector<FileReadResult> &results,
+                              std::size_t workers)
+    {
+      std::atomic<std::size_t> next{0};
+      std::latch finished{static_cast<std::ptrdiff_t>(workers)};
+
+      for (std::size_t w = 0; w < workers; ++w)
+      {
+        pool.post([&]
+                  {
+                    for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                         i < paths.size();
+                         i = next.fetch_add(1, std::memory_order_relaxed))
+                    {
+                      read_one_into(paths[i], results[i]);
+                    }
+                    finished.count_down(); });
+      }
+
+      finished.wait();
+    }
+  } // namespace detail
+
+  /**
+   * @brief Read many files as bytes concurrently on an existing pool.
+   *
+   * Never throws for per-file failures: each entry carries either the file
+   * content or the error that prevented reading it. Results are in the same
+   * order as `paths`. Blocks until every file is read, so it must not be
+   * called from a task running on `pool`.
+   *
+   * @param pool Pool that runs the readers; at most `pool.size()` files are read at once.
+   * @param paths Files to read.
+   * @return One result per path.
+   */
+  [[nodiscard]] inline std::vector<FileReadResult> read_files_binary(ThreadPool &pool,
+                                                                     std::span<const std::filesystem::path> paths)
+  {
+    std::vector<FileReadResult> results(paths.size());
+    if (paths.empty())
+    {
+      return results;
+    }
+
+    detail::read_batch_on(pool, paths, results, std::min(pool.size(), paths.size()));
+    return results;
+  }
+
+  /**
+   * @brief Read many files as bytes concurrently.
+   *
+   * Spawns a bounded pool for the duration of the call. With a single
+   * worker or a single path, files are read on the calling thread.
+   *
+   * @param paths Files to read.
+   * @param options Concurrency bound.
+   * @return One result per path, in the same order.
+   */
+  [[nodiscard]] inline std::vector<FileReadResult> read_files_binary(std::span<const std::filesystem::path> paths,
+                                                                     BatchReadOptions options = {})
+  {
+    const std::size_t threads = options.threads == 0 ? ThreadPool::default_thread_count() : options.threads;
+    const std::size_t workers = std::min(threads, paths.size());
+
+    if (workers <= 1)
+    {
+      std::vector<FileReadResult> results(paths.size());
+      for (std::size_t i = 0; i < paths.size(); ++i)
+      {
+        detail::read_one_into(paths[i], results[i]);
+      }
+      return results;
+    }
+
+    ThreadPool pool{workers};
+    return read_files_binary(pool, paths);
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_BATCH_READER_HPP
@@ -13,6 +13,9 @@
 
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <new>
+#include <memory_resource>
 #include <span>
 #include <stdexcept>
 #include <string>
@@ -21,8 +24,100 @@
 #include <utility>
 #include <vector>
 
+#include <rix/io/endian.hpp>
+#include <rix/io/varint.hpp>
+
 namespace rix::io
 {
+  /**
+   * @brief Allocator adaptor that default-initializes instead of value-initializing.
+   *
+   * `std::vector<T, DefaultInitAllocator<T>>::resize(n)` leaves new trivial
+   * elements indeterminate instead of zeroing them, which saves a full memset
+   * pass when the bytes are overwritten right away (e.g. by a read).
+   */
+  template <class T, class Base = std::allocator<T>>
+  class DefaultInitAllocator : public Base
+  {
+    using traits = std::allocator_traits<Base>;
+
+  public:
+    template <class U>
+    struct rebind
+    {
+      using other = DefaultInitAllocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using Base::Base;
+
+    DefaultInitAllocator() = default;
+
+    template <class U, class B>
+    DefaultInitAllocator(const DefaultInitAllocator<U, B> &other) noexcept
+        : Base(static_cast<const B &>(other))
+    {
+    }
+
+    template <class U>
+    void construct(U *p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+      ::new (static_cast<void *>(p)) U;
+    }
+
+    template <class U, class... Args>
+    void construct(U *p, Args &&...args)
+    {
+      traits::construct(static_cast<Base &>(*this), p, std::forward<Args>(args)...);
+    }
+  };
+
+  /**
+   * @brief Alignment that satisfies direct I/O on common devices and filesystems.
+   */
+  inline constexpr std::size_t direct_io_alignment = 4096;
+
+  /**
+   * @brief Allocator returning storage aligned to `Alignment` bytes.
+   */
+  template <class T, std::size_t Alignment>
+  class AlignedAllocator
+  {
+    static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(T),
+                  "AlignedAllocator requires a power-of-two alignment of at least alignof(T)");
+
+  public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind
+    {
+      using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t n)
+    {
+      return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T *p, std::size_t) noexcept
+    {
+      ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template <class U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept
+    {
+      return true;
+    }
+  };
+
   /**
    * @brief Owning contiguous byte buffer.
    *
@@ -30,41 +125,65 @@ namespace rix::io
    * - Span-based access
    * - Text helpers (no UTF-8 validation)
    * - POD read/write helpers (native endianness)
+   * - Explicit little/big-endian encoding helpers (`*_le`, `*_be`)
+   * - LEB128 varints and length-prefixed payloads
    *
    * No implicit encoding or endian conversion is performed.
+   *
+   * Storage is obtained from `Allocator`; `Buffer` uses the default allocator
+   * and `pmr::Buffer` draws from a `std::pmr::memory_resource`.
    */
-  class Buffer
+  template <class Allocator = std::allocator<std::byte>>
+  class BasicBuffer
   {
   public:
     using value_type = std::byte;
-    using storage_type = std::vector<std::byte>;
+    using allocator_type = Allocator;
+    using storage_type = std::vector<std::byte, Allocator>;
     using size_type = std::size_t;
 
-    Buffer() = default;
+    BasicBuffer() = default;
 
-    explicit Buffer(size_type size)
-        : data_(size)
+    explicit BasicBuffer(const allocator_type &alloc) noexcept
+        : data_(alloc)
     {
     }
 
-    explicit Buffer(const storage_type &bytes)
+    explicit BasicBuffer(size_type size, const allocator_type &alloc = allocator_type())
+        : data_(size, alloc)
+    {
+    }
+
+    explicit BasicBuffer(const storage_type &bytes)
         : data_(bytes)
     {
     }
 
-    explicit Buffer(storage_type &&bytes) noexcept
+    explicit BasicBuffer(storage_type &&bytes) noexcept
         : data_(std::move(bytes))
     {
     }
 
-    explicit Buffer(std::string_view text) { assign(text); }
+    explicit BasicBuffer(std::string_view text, const allocator_type &alloc = allocator_type())
+        : data_(alloc)
+    {
+      assign(text);
+    }
 
-    explicit Buffer(std::span<const std::byte> bytes) { assign(bytes); }
+    explicit BasicBuffer(std::span<const std::byte> bytes, const allocator_type &alloc = allocator_type())
+        : data_(alloc)
+    {
+      assign(bytes);
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return data_.get_allocator(); }
 
     [[nodiscard]] size_type size() const noexcept { return data_.size(); }
 
     [[nodiscard]] bool empty() const noexcept { return data_.empty(); }
 
+    [[nodiscard]] size_type capacity() const noexcept { return data_.capacity(); }
+
     [[nodiscard]] std::byte *data() noexcept { return data_.data(); }
 
     [[nodiscard]] const std::byte *data() const noexcept { return data_.data(); }
@@ -129,21 +248,29 @@ namespace rix::io
     void clear() noexcept { data_.clear(); }
 
     /**
-     * @brief Clear and release memory.
+     * @brief Clear and release memory back to the allocator.
      */
     void reset() noexcept
     {
-      storage_type tmp;
+      storage_type tmp(data_.get_allocator());
       data_.swap(tmp);
     }
 
     void resize(size_type size) { data_.resize(size); }
 
+    /**
+     * @brief Resize for bytes the caller is about to overwrite.
+     *
+     * With `DefaultInitAllocator` (see `UninitializedBuffer`) the new bytes
+     * are left indeterminate; other allocators zero them as `resize()` does.
+     */
+    void resize_uninitialized(size_type size) { data_.resize(size); }
+
     void reserve(size_type cap) { data_.reserve(cap); }
 
     void shrink_to_fit() { data_.shrink_to_fit(); }
 
-    void swap(Buffer &other) noexcept { data_.swap(other.data_); }
+    void swap(BasicBuffer &other) noexcept { data_.swap(other.data_); }
 
     void assign(std::string_view text)
     {
@@ -166,9 +293,8 @@ namespace rix::io
         return;
       }
 
-      const auto old = data_.size();
-      data_.resize(old + text.size());
-      std::memcpy(data_.data() + old, text.data(), text.size());
+      const auto *p = reinterpret_cast<const std::byte *>(text.data());
+      data_.insert(data_.end(), p, p + text.size());
     }
 
     void append(std::span<const std::byte> bytes)
@@ -225,9 +351,8 @@ namespace rix::io
     {
       static_assert(std::is_trivially_copyable_v<T>, "append_pod requires trivially copyable type");
 
-      const auto old = data_.size();
-      data_.resize(old + sizeof(T));
-      std::memcpy(data_.data() + old, &value, sizeof(T));
+      const auto *p = reinterpret_cast<const std::byte *>(&value);
+      data_.insert(data_.end(), p, p + sizeof(T));
     }
 
     /**
@@ -268,10 +393,170 @@ namespace rix::io
       std::memcpy(data_.data() + offset, &value, sizeof(T));
     }
 
+    /**
+     * @brief Append a value encoded little-endian.
+     */
+    template <EndianScalar T>
+    void append_le(T value)
+    {
+      append_pod(convert_endian<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Append a value encoded big-endian.
+     */
+    template <EndianScalar T>
+    void append_be(T value)
+    {
+      append_pod(convert_endian<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Append every value of `values` encoded little-endian.
+     */
+    template <EndianScalar T>
+    void append_array_le(std::span<const T> values)
+    {
+      append_array_endian<std::endian::little>(values);
+    }
+
+    /**
+     * @brief Append every value of `values` encoded big-endian.
+     */
+    template <EndianScalar T>
+    void append_array_be(std::span<const T> values)
+    {
+      append_array_endian<std::endian::big>(values);
+    }
+
+    /**
+     * @brief Read a little-endian value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_le(size_type offset) const
+    {
+      return convert_endian<std::endian::little>(read_pod<T>(offset));
+    }
+
+    /**
+     * @brief Read a big-endian value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_be(size_type offset) const
+    {
+      return convert_endian<std::endian::big>(read_pod<T>(offset));
+    }
+
+    /**
+     * @brief Overwrite a value at offset, encoded little-endian.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    void write_le(size_type offset, T value)
+    {
+      write_pod(offset, convert_endian<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Overwrite a value at offset, encoded big-endian.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    void write_be(size_type offset, T value)
+    {
+      write_pod(offset, convert_endian<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Append `value` as an unsigned LEB128 varint (1 to 10 bytes).
+     */
+    void append_varint(std::uint64_t value)
+    {
+      std::byte tmp[max_varint_size];
+      const std::size_t n = encode_varint(value, tmp);
+      data_.insert(data_.end(), tmp, tmp + n);
+    }
+
+    /**
+     * @brief Append `value` ZigZag-mapped then LEB128-encoded.
+     */
+    void append_varint_signed(std::int64_t value) { append_varint(zigzag_encode(value)); }
+
+    /**
+     * @brief Append the varint length of `text` followed by its bytes.
+     */
+    void append_length_prefixed(std::string_view text)
+    {
+      append_length_prefixed(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    /**
+     * @brief Append the varint length of `bytes` followed by the bytes.
+     */
+    void append_length_prefixed(std::span<const std::byte> bytes)
+    {
+      std::byte tmp[max_varint_size];
+      const std::size_t n = encode_varint(bytes.size(), tmp);
+
+      data_.reserve(data_.size() + n + bytes.size());
+      data_.insert(data_.end(), tmp, tmp + n);
+      data_.insert(data_.end(), bytes.begin(), bytes.end());
+    }
+
   private:
     storage_type data_{};
+
+    template <std::endian Order, class T>
+    void append_array_endian(std::span<const T> values)
+    {
+      if constexpr (Order == std::endian::native || sizeof(T) == 1)
+      {
+        append(std::as_bytes(values));
+      }
+      else
+      {
+        const auto old = data_.size();
+        resize_uninitialized(old + values.size_bytes());
+        detail::store_endian<Order>(data_.data() + old, values);
+      }
+    }
   };
 
+  /**
+   * @brief Byte buffer using the default allocator.
+   */
+  using Buffer = BasicBuffer<>;
+
+  /**
+   * @brief Byte buffer whose `resize()` does not zero new bytes.
+   *
+   * Best suited as a reusable read target for `read_file_into()`.
+   */
+  using UninitializedBuffer = BasicBuffer<DefaultInitAllocator<std::byte>>;
+
+  /**
+   * @brief Byte buffer whose storage starts on an `Alignment` boundary, for direct I/O.
+   *
+   * New bytes are not zeroed. Only the start is aligned: keep sizes and
+   * offsets passed to `read_at()` / `write_at()` multiples of `Alignment`.
+   */
+  template <std::size_t Alignment = direct_io_alignment>
+  using AlignedBuffer = BasicBuffer<DefaultInitAllocator<std::byte, AlignedAllocator<std::byte, Alignment>>>;
+
+  namespace pmr
+  {
+    /**
+     * @brief Byte buffer drawing its storage from a `std::pmr::memory_resource`.
+     */
+    using Buffer = BasicBuffer<std::pmr::polymorphic_allocator<std::byte>>;
+  } // namespace pmr
+
 } // namespace rix::io
 
 #endif // RIX_IO_BUFFER_HPP
@@ -0,0 +1,332 @@
+/**
+ * @file buffer_chain.hpp
+ * @brief Chain of shared byte segments with cheap append, slicing and gather writes.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_BUFFER_CHAIN_HPP
+#define RIX_IO_BUFFER_CHAIN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/file.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `BufferChain`.
+   */
+  struct BufferChainOptions
+  {
+    /**
+     * @brief Capacity of the segments created for copied appends.
+     */
+    std::size_t segment_size{16 * 1024};
+  };
+
+  /**
+   * @brief Sequence of byte ranges over reference-counted `Buffer` segments.
+   *
+   * Appending or prepending a whole buffer is O(1) and never copies bytes;
+   * small copied appends are packed into segments of `segment_size`.
+   * Copies and slices share segments instead of duplicating them, and shared
+   * segments are never modified. `write_to()` hands the segments to the
+   * vectored `File::write()` without flattening.
+   *
+   * Views returned by `spans()` are invalidated by any modification of the chain.
+   */
+  class BufferChain
+  {
+  public:
+    using size_type = std::size_t;
+
+    BufferChain() = default;
+
+    explicit BufferChain(BufferChainOptions options)
+        : options_(options)
+    {
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] size_type segment_count() const noexcept { return segments_.size(); }
+
+    void clear() noexcept
+    {
+      segments_.clear();
+      size_ = 0;
+    }
+
+    /**
+     * @brief Copy `text` to the end of the chain.
+     */
+    void append(std::string_view text)
+    {
+      append(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    /**
+     * @brief Copy `bytes` to the end of the chain.
+     *
+     * Fills the unshared tail segment first; new segments are reserved up
+     * front and never reallocated, so existing segments never move.
+     */
+    void append(std::span<const std::byte> bytes)
+    {
+      if (bytes.empty())
+      {
+        return;
+      }
+
+      if (Segment *tail = writable_tail())
+      {
+        const size_type room = tail->storage->capacity() - tail->storage->size();
+        const size_type n = std::min(room, bytes.size());
+        tail->storage->append(bytes.first(n));
+        tail->length += n;
+        size_ += n;
+        bytes = bytes.subspan(n);
+      }
+
+      if (!bytes.empty())
+      {
+        auto storage = std::make_shared<Buffer>();
+        storage->reserve(std::max(options_.segment_size, bytes.size()));
+        storage->append(bytes);
+        push_back_segment(Segment{std::move(storage), 0, bytes.size()});
+      }
+    }
+
+    /**
+     * @brief Take ownership of `buffer` as a new last segment (no copy).
+     */
+    void append(Buffer &&buffer)
+    {
+      if (!buffer.empty())
+      {
+        const size_type n = buffer.size();
+        push_back_segment(Segment{std::make_shared<Buffer>(std::move(buffer)), 0, n});
+      }
+    }
+
+    /**
+     * @brief Share `buffer` as a new last segment (no copy).
+     */
+    void append(std::shared_ptr<const Buffer> buffer)
+    {
+      if (buffer && !buffer->empty())
+      {
+        const size_type n = buffer->size();
+        push_back_segment(Segment{std::const_pointer_cast<Buffer>(std::move(buffer)), 0, n, true});
+      }
+    }
+
+    /**
+     * @brief Share every segment of `other` at the end of this chain (no byte copy).
+     */
+    void append(const BufferChain &other)
+    {
+      // Index-based so that appending a chain to itself is well defined.
+      const size_type count = other.segments_.size();
+      for (size_type i = 0; i < count; ++i)
+      {
+        Segment s = other.segments_[i];
+        s.shared = true;
+        push_back_segment(std::move(s));
+      }
+    }
+
+    /**
+     * @brief Copy `text` to the front of the chain.
+     */
+    void prepend(std::string_view text) { prepend(Buffer{text}); }
+
+    /**
+     * @brief Take ownership of `buffer` as a new first segment (no copy).
+     */
+    void prepend(Buffer &&buffer)
+    {
+      if (!buffer.empty())
+      {
+        const size_type n = buffer.size();
+        push_front_segment(Segment{std::make_shared<Buffer>(std::move(buffer)), 0, n});
+      }
+    }
+
+    /**
+     * @brief Share `buffer` as a new first segment (no copy).
+     */
+    void prepend(std::shared_ptr<const Buffer> buffer)
+    {
+      if (buffer && !buffer->empty())
+      {
+        const size_type n = buffer->size();
+        push_front_segment(Segment{std::const_pointer_cast<Buffer>(std::move(buffer)), 0, n, true});
+      }
+    }
+
+    /**
+     * @brief Chain viewing `length` bytes starting at `offset`, sharing segments.
+     *
+     * @throws std::invalid_argument if the range is out of bounds.
+     */
+    [[nodiscard]] BufferChain slice(size_type offset, size_type length) const
+    {
+      if (offset > size_ || length > size_ - offset)
+      {
+        throw std::invalid_argument("rix::io::BufferChain::slice: out of range");
+      }
+
+      BufferChain out{options_};
+      for (const auto &seg : segments_)
+      {
+        if (length == 0)
+        {
+          break;
+        }
+        if (offset >= seg.length)
+        {
+          offset -= seg.length;
+          continue;
+        }
+
+        const size_type n = std::min(seg.length - offset, length);
+        out.push_back_segment(Segment{seg.storage, seg.offset + offset, n, true});
+        offset = 0;
+        length -= n;
+      }
+      return out;
+    }
+
+    /**
+     * @brief Drop the first `n` bytes, e.g. after a partial write.
+     *
+     * @throws std::invalid_argument if `n > size()`.
+     */
+    void remove_prefix(size_type n)
+    {
+      if (n > size_)
+      {
+        throw std::invalid_argument("rix::io::BufferChain::remove_prefix: out of range");
+      }
+
+      size_ -= n;
+      while (n != 0)
+      {
+        Segment &front = segments_.front();
+        if (n < front.length)
+        {
+          front.offset += n;
+          front.length -= n;
+          break;
+        }
+        n -= front.length;
+        segments_.pop_front();
+      }
+    }
+
+    /**
+     * @brief One view per segment, in order, suitable for `File::write(parts)`.
+     */
+    [[nodiscard]] std::vector<std::span<const std::byte>> spans() const
+    {
+      std::vector<std::span<const std::byte>> out;
+      out.reserve(segments_.size());
+      for (const auto &seg : segments_)
+      {
+        out.push_back(view(seg));
+      }
+      return out;
+    }
+
+    /**
+     * @brief Copy the whole chain into one contiguous buffer.
+     */
+    [[nodiscard]] Buffer flatten() const
+    {
+      Buffer out;
+      out.reserve(size_);
+      for (const auto &seg : segments_)
+      {
+        out.append(view(seg));
+      }
+      return out;
+    }
+
+    /**
+     * @brief Gather-write the chain to `file` without flattening it.
+     *
+     * @throws std::runtime_error if the file is not writable or writing fails.
+     */
+    void write_to(File &file) const
+    {
+      const auto parts = spans();
+      file.write(std::span<const std::span<const std::byte>>(parts));
+    }
+
+  private:
+    struct Segment
+    {
+      std::shared_ptr<Buffer> storage;
+      size_type offset{0};
+      size_type length{0};
+
+      // Bytes may be referenced elsewhere: never write into this segment.
+      bool shared{false};
+    };
+
+    BufferChainOptions options_{};
+    std::deque<Segment> segments_{};
+    size_type size_{0};
+
+    [[nodiscard]] static std::span<const std::byte> view(const Segment &seg) noexcept
+    {
+      return std::span<const std::byte>(seg.storage->data() + seg.offset, seg.length);
+    }
+
+    [[nodiscard]] Segment *writable_tail() noexcept
+    {
+      if (segments_.empty())
+      {
+        return nullptr;
+      }
+
+      Segment &tail = segments_.back();
+      const bool owned = !tail.shared && tail.storage.use_count() == 1;
+      const bool at_end = tail.offset + tail.length == tail.storage->size();
+      const bool has_room = tail.storage->size() < tail.storage->capacity();
+      return (owned && at_end && has_room) ? &tail : nullptr;
+    }
+
+    void push_back_segment(Segment seg)
+    {
+      size_ += seg.length;
+      segments_.push_back(std::move(seg));
+    }
+
+    void push_front_segment(Segment seg)
+    {
+      size_ += seg.length;
+      segments_.push_front(std::move(seg));
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_BUFFER_CHAIN_HPP
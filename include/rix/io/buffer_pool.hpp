@@ -0,0 +1,201 @@
+/**
+ * @file buffer_pool.hpp
+ * @brief Recycling pool of fixed-capacity byte buffers.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_BUFFER_POOL_HPP
+#define RIX_IO_BUFFER_POOL_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <rix/io/buffer.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `BufferPool`.
+   */
+  struct BufferPoolOptions
+  {
+    /**
+     * @brief Capacity reserved for every buffer handed out.
+     */
+    std::size_t buffer_capacity{64 * 1024};
+
+    /**
+     * @brief Maximum number of idle buffers kept for reuse.
+     */
+    std::size_t max_cached{64};
+  };
+
+  class BufferPool;
+
+  /**
+   * @brief Buffer borrowed from a `BufferPool`, returned to it on destruction.
+   *
+   * The buffer is empty when acquired and keeps at least the pool capacity.
+   * The pool must outlive every `PooledBuffer` it hands out.
+   */
+  class PooledBuffer
+  {
+  public:
+    PooledBuffer() = default;
+
+    ~PooledBuffer() noexcept;
+
+    PooledBuffer(const PooledBuffer &) = delete;
+    PooledBuffer &operator=(const PooledBuffer &) = delete;
+
+    PooledBuffer(PooledBuffer &&other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)),
+          buffer_(std::move(other.buffer_))
+    {
+    }
+
+    PooledBuffer &operator=(PooledBuffer &&other) noexcept;
+
+    [[nodiscard]] Buffer &get() noexcept { return buffer_; }
+
+    [[nodiscard]] const Buffer &get() const noexcept { return buffer_; }
+
+    [[nodiscard]] Buffer &operator*() noexcept { return buffer_; }
+
+    [[nodiscard]] const Buffer &operator*() const noexcept { return buffer_; }
+
+    [[nodiscard]] Buffer *operator->() noexcept { return &buffer_; }
+
+    [[nodiscard]] const Buffer *operator->() const noexcept { return &buffer_; }
+
+    /**
+     * @brief Detach the buffer from the pool; it will not be recycled.
+     */
+    [[nodiscard]] Buffer release() noexcept
+    {
+      pool_ = nullptr;
+      return std::move(buffer_);
+    }
+
+  private:
+    friend class BufferPool;
+
+    PooledBuffer(BufferPool *pool, Buffer &&buffer) noexcept
+        : pool_(pool),
+          buffer_(std::move(buffer))
+    {
+    }
+
+    void give_back() noexcept;
+
+    BufferPool *pool_{nullptr};
+    Buffer buffer_{};
+  };
+
+  /**
+   * @brief Thread-safe pool handing out recycled buffers of a fixed capacity.
+   *
+   * Once warmed up, acquire/release cycles perform no allocation. Buffers
+   * that were shrunk below the pool capacity, or grew beyond twice of it,
+   * are freed instead of cached, so idle memory stays near
+   * `max_cached * buffer_capacity`.
+   */
+  class BufferPool
+  {
+  public:
+    explicit BufferPool(BufferPoolOptions options = {})
+        : options_(options)
+    {
+      free_.reserve(options_.max_cached);
+    }
+
+    BufferPool(const BufferPool &) = delete;
+    BufferPool &operator=(const BufferPool &) = delete;
+
+    /**
+     * @brief Borrow an empty buffer with at least `buffer_capacity()` bytes reserved.
+     */
+    [[nodiscard]] PooledBuffer acquire()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty())
+        {
+          Buffer b = std::move(free_.back());
+          free_.pop_back();
+          return PooledBuffer{this, std::move(b)};
+        }
+      }
+
+      Buffer b;
+      b.reserve(options_.buffer_capacity);
+      return PooledBuffer{this, std::move(b)};
+    }
+
+    /**
+     * @brief Number of idle buffers ready for reuse.
+     */
+    [[nodiscard]] std::size_t cached() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return free_.size();
+    }
+
+    [[nodiscard]] std::size_t buffer_capacity() const noexcept { return options_.buffer_capacity; }
+
+  private:
+    friend class PooledBuffer;
+
+    BufferPoolOptions options_;
+    mutable std::mutex mutex_;
+    std::vector<Buffer> free_;
+
+    void recycle(Buffer &&b) noexcept
+    {
+      const std::size_t cap = b.capacity();
+      if (cap < options_.buffer_capacity || cap / 2 > options_.buffer_capacity)
+      {
+        return;
+      }
+
+      b.clear();
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (free_.size() < options_.max_cached)
+      {
+        // Never reallocates: `free_` was reserved to `max_cached` up front.
+        free_.push_back(std::move(b));
+      }
+    }
+  };
+
+  inline PooledBuffer::~PooledBuffer() noexcept { give_back(); }
+
+  inline PooledBuffer &PooledBuffer::operator=(PooledBuffer &&other) noexcept
+  {
+    if (this != &other)
+    {
+      give_back();
+      pool_ = std::exchange(other.pool_, nullptr);
+      buffer_ = std::move(other.buffer_);
+    }
+    return *this;
+  }
+
+  inline void PooledBuffer::give_back() noexcept
+  {
+    if (pool_ != nullptr)
+    {
+      std::exchange(pool_, nullptr)->recycle(std::move(buffer_));
+    }
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_BUFFER_POOL_HPP
@@ -0,0 +1,328 @@
+/**
+ * @file buffer_reader.hpp
+ * @brief Non-owning cursor for decoding trivially copyable values from bytes.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_BUFFER_READER_HPP
+#define RIX_IO_BUFFER_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <rix/io/endian.hpp>
+#include <rix/io/varint.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Forward-only read cursor over a byte span.
+   *
+   * Works over any contiguous bytes: `Buffer::span()`, `MappedFile::span()`,
+   * a network packet... The viewed bytes must outlive the reader.
+   *
+   * `read()` uses native endianness; `read_le()` / `read_be()` decode an
+   * explicit byte order. Throwing reads leave the cursor
+   * unchanged on failure; `try_read()` reports failure with `std::nullopt`.
+   */
+  class BufferReader
+  {
+  public:
+    using size_type = std::size_t;
+
+    BufferReader() = default;
+
+    explicit BufferReader(std::span<const std::byte> data) noexcept
+        : data_(data)
+    {
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return data_.size(); }
+
+    [[nodiscard]] size_type position() const noexcept { return pos_; }
+
+    [[nodiscard]] size_type remaining() const noexcept { return data_.size() - pos_; }
+
+    [[nodiscard]] bool eof() const noexcept { return pos_ == data_.size(); }
+
+    /**
+     * @brief Bytes from the current position to the end.
+     */
+    [[nodiscard]] std::span<const std::byte> rest() const noexcept { return data_.subspan(pos_); }
+
+    /**
+     * @brief Move the cursor to an absolute position.
+     *
+     * @throws std::invalid_argument if `pos` is past the end.
+     */
+    void seek(size_type pos)
+    {
+      if (pos > data_.size())
+      {
+        fail("seek");
+      }
+      pos_ = pos;
+    }
+
+    /**
+     * @brief Advance the cursor by `n` bytes.
+     *
+     * @throws std::invalid_argument if fewer than `n` bytes remain.
+     */
+    void skip(size_type n)
+    {
+      require(n, "skip");
+      pos_ += n;
+    }
+
+    /**
+     * @brief Read the next `T` and advance past it.
+     *
+     * @throws std::invalid_argument if fewer than `sizeof(T)` bytes remain.
+     */
+    template <class T>
+    [[nodiscard]] T read()
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "read requires trivially copyable type");
+
+      require(sizeof(T), "read");
+      T out{};
+      std::memcpy(&out, data_.data() + pos_, sizeof(T));
+      pos_ += sizeof(T);
+      return out;
+    }
+
+    /**
+     * @brief Read the next `T` if enough bytes remain.
+     *
+     * @return The value, or `std::nullopt` (cursor unchanged) on short input.
+     */
+    template <class T>
+    [[nodiscard]] std::optional<T> try_read() noexcept
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "try_read requires trivially copyable type");
+
+      if (remaining() < sizeof(T))
+      {
+        return std::nullopt;
+      }
+
+      T out{};
+      std::memcpy(&out, data_.data() + pos_, sizeof(T));
+      pos_ += sizeof(T);
+      return out;
+    }
+
+    /**
+     * @brief View the next `n` bytes without copying and advance past them.
+     *
+     * @throws std::invalid_argument if fewer than `n` bytes remain.
+     */
+    [[nodiscard]] std::span<const std::byte> read_span(size_type n)
+    {
+      require(n, "read_span");
+      const auto out = data_.subspan(pos_, n);
+      pos_ += n;
+      return out;
+    }
+
+    /**
+     * @brief Read `out.size()` consecutive values of `T` into `out`.
+     *
+     * Bounds are checked once for the whole batch and the values are copied
+     * with a single `memcpy`.
+     *
+     * @throws std::invalid_argument if the input is too short (cursor unchanged).
+     */
+    template <class T>
+    void read_array(std::span<T> out)
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "read_array requires trivially copyable type");
+
+      if (out.size() > remaining() / sizeof(T))
+      {
+        fail("read_array");
+      }
+
+      const size_type n = out.size() * sizeof(T);
+      if (n != 0)
+      {
+        std::memcpy(out.data(), data_.data() + pos_, n);
+      }
+      pos_ += n;
+    }
+
+    /**
+     * @brief Read `count` consecutive values of `T` into a new vector.
+     *
+     * @throws std::invalid_argument if the input is too short (cursor unchanged).
+     */
+    template <class T>
+    [[nodiscard]] std::vector<T> read_array(size_type count)
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "read_array requires trivially copyable type");
+
+      if (count > remaining() / sizeof(T))
+      {
+        fail("read_array");
+      }
+
+      std::vector<T> out(count);
+      read_array(std::span<T>(out));
+      return out;
+    }
+
+    /**
+     * @brief Read the next little-endian value.
+     *
+     * @throws std::invalid_argument if fewer than `sizeof(T)` bytes remain.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_le()
+    {
+      return convert_endian<std::endian::little>(read<T>());
+    }
+
+    /**
+     * @brief Read the next big-endian value.
+     *
+     * @throws std::invalid_argument if fewer than `sizeof(T)` bytes remain.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_be()
+    {
+      return convert_endian<std::endian::big>(read<T>());
+    }
+
+    /**
+     * @brief Read `out.size()` little-endian values with one bounds check.
+     *
+     * @throws std::invalid_argument if the input is too short (cursor unchanged).
+     */
+    template <EndianScalar T>
+    void read_array_le(std::span<T> out)
+    {
+      read_array(out);
+      if constexpr (std::endian::native != std::endian::little)
+      {
+        byte_swap_inplace(out);
+      }
+    }
+
+    /**
+     * @brief Read `out.size()` big-endian values with one bounds check.
+     *
+     * @throws std::invalid_argument if the input is too short (cursor unchanged).
+     */
+    template <EndianScalar T>
+    void read_array_be(std::span<T> out)
+    {
+      read_array(out);
+      if constexpr (std::endian::native != std::endian::big)
+      {
+        byte_swap_inplace(out);
+      }
+    }
+
+    /**
+     * @brief Read the next unsigned LEB128 varint.
+     *
+     * @throws std::invalid_argument if the input is truncated or the value overflows (cursor unchanged).
+     */
+    [[nodiscard]] std::uint64_t read_varint()
+    {
+      std::uint64_t v = 0;
+      const std::size_t n = decode_varint(rest(), v);
+      if (n == 0)
+      {
+        fail("read_varint");
+      }
+      pos_ += n;
+      return v;
+    }
+
+    /**
+     * @brief Read the next unsigned LEB128 varint if it is complete and valid.
+     *
+     * @return The value, or `std::nullopt` (cursor unchanged).
+     */
+    [[nodiscard]] std::optional<std::uint64_t> try_read_varint() noexcept
+    {
+      std::uint64_t v = 0;
+      const std::size_t n = decode_varint(rest(), v);
+      if (n == 0)
+      {
+        return std::nullopt;
+      }
+      pos_ += n;
+      return v;
+    }
+
+    /**
+     * @brief Read the next ZigZag-encoded signed varint.
+     *
+     * @throws std::invalid_argument if the input is truncated or the value overflows (cursor unchanged).
+     */
+    [[nodiscard]] std::int64_t read_varint_signed() { return zigzag_decode(read_varint()); }
+
+    /**
+     * @brief Read a varint length followed by that many bytes, without copying.
+     *
+     * @throws std::invalid_argument if the input is truncated (cursor unchanged).
+     */
+    [[nodiscard]] std::span<const std::byte> read_length_prefixed()
+    {
+      std::uint64_t len = 0;
+      const std::size_t n = decode_varint(rest(), len);
+      if (n == 0 || len > remaining() - n)
+      {
+        fail("read_length_prefixed");
+      }
+
+      const auto out = data_.subspan(pos_ + n, static_cast<size_type>(len));
+      pos_ += n + static_cast<size_type>(len);
+      return out;
+    }
+
+    /**
+     * @brief Like `read_length_prefixed()`, viewed as text (no UTF-8 validation).
+     */
+    [[nodiscard]] std::string_view read_length_prefixed_text()
+    {
+      const auto bytes = read_length_prefixed();
+      return std::string_view(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    }
+
+  private:
+    std::span<const std::byte> data_{};
+    size_type pos_{0};
+
+    void require(size_type n, const char *what) const
+    {
+      if (n > remaining())
+      {
+        fail(what);
+      }
+    }
+
+    [[noreturn]] static void fail(const char *what)
+    {
+      throw std::invalid_argument(std::string("rix::io::BufferReader::") + what + ": out of range");
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_BUFFER_READER_HPP
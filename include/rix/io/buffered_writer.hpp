@@ -0,0 +1,255 @@
+/**
+ * @file buffered_writer.hpp
+ * @brief Long-lived file writer that batches small writes in memory.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_BUFFERED_WRITER_HPP
+#define RIX_IO_BUFFERED_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/file.hpp>
+#include <rix/io/writer.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `BufferedWriter`.
+   */
+  struct BufferedWriterOptions
+  {
+    /**
+     * @brief Staging capacity in bytes; reaching it triggers a flush. Must be non-zero.
+     */
+    std::size_t capacity{64 * 1024};
+
+    /**
+     * @brief Expected number of bytes to be written; when non-zero, space is
+     *        preallocated up front (native files, best effort).
+     */
+    std::uint64_t size_hint{0};
+  };
+
+  /**
+   * @brief Owns a `File` and stages writes in a `Buffer` before issuing them.
+   *
+   * Many small `write()` calls are coalesced into a few large writes:
+   * - the staging buffer is written out when it reaches `capacity`
+   * - a write larger than the capacity bypasses staging after draining it
+   * - `flush()` writes out whatever is staged
+   *
+   * The destructor flushes on a best-effort basis and never throws; call
+   * `close()` to observe errors from the final flush.
+   */
+  class BufferedWriter
+  {
+  public:
+    /**
+     * @brief Open `path` for buffered writing.
+     *
+     * The file is opened with `FileType::binary` and `FileBackend::native`.
+     *
+     * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if `options.capacity` is zero or `mode` is
+     *         `WriteMode::atomic_replace`, which needs the whole content up front.
+     */
+    explicit BufferedWriter(const std::filesystem::path &path,
+                            WriteMode mode = WriteMode::truncate,
+                            BufferedWriterOptions options = {})
+        : BufferedWriter(File{path, streaming_mode(mode), FileType::binary, FileBackend::native}, options)
+    {
+    }
+
+    /**
+     * @brief Take ownership of an open, writable file.
+     *
+     * @throws std::invalid_argument if the file is unsuitable or `options.capacity` is zero.
+     */
+    explicit BufferedWriter(File &&file, BufferedWriterOptions options = {})
+        : file_(std::move(file)), capacity_(options.capacity)
+    {
+      if (capacity_ == 0)
+      {
+        throw std::invalid_argument("rix::io::BufferedWriter: capacity must be non-zero");
+      }
+
+      if (!file_.is_open() || !detail::mode_can_write(file_.mode()))
+      {
+        throw std::invalid_argument("rix::io::BufferedWriter: requires an open writable file");
+      }
+
+      staging_.reserve(capacity_);
+
+      if (options.size_hint != 0 && file_.backend() == FileBackend::native)
+      {
+        (void)file_.preallocate(file_.size() + options.size_hint);
+      }
+    }
+
+    /**
+     * @brief Flush staged bytes and close the file.
+     *
+     * Never throws.
+     */
+    ~BufferedWriter() noexcept
+    {
+      try
+      {
+        close();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    BufferedWriter(const BufferedWriter &) = delete;
+    BufferedWriter &operator=(const BufferedWriter &) = delete;
+
+    BufferedWriter(BufferedWriter &&) noexcept = default;
+
+    BufferedWriter &operator=(BufferedWriter &&other) noexcept
+    {
+      if (this != &other)
+      {
+        try
+        {
+          close();
+        }
+        catch (...)
+        {
+        }
+        file_ = std::move(other.file_);
+        staging_ = std::move(other.staging_);
+        capacity_ = other.capacity_;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Stage text for writing.
+     *
+     * @throws std::runtime_error if a triggered flush fails.
+     */
+    void write(std::string_view text)
+    {
+      write(std::span<const std::byte>(reinterpret_cast<const std::byte *>(text.data()), text.size()));
+    }
+
+    /**
+     * @brief Stage bytes for writing.
+     *
+     * @throws std::runtime_error if a triggered flush fails.
+     */
+    void write(std::span<const std::byte> bytes)
+    {
+      if (bytes.size() >= capacity_)
+      {
+        flush_staging();
+        file_.write(bytes);
+        return;
+      }
+
+      if (staging_.size() + bytes.size() > capacity_)
+      {
+        flush_staging();
+      }
+
+      staging_.append(bytes);
+
+      if (staging_.size() == capacity_)
+      {
+        flush_staging();
+      }
+    }
+
+    /**
+     * @brief Write out staged bytes and flush the file.
+     *
+     * @throws std::runtime_error if writing or flushing fails.
+     */
+    void flush()
+    {
+      flush_staging();
+      file_.flush();
+    }
+
+    /**
+     * @brief Flush and close the file.
+     *
+     * Does nothing if already closed.
+     *
+     * @throws std::runtime_error if the final flush fails (the file is closed regardless).
+     */
+    void close()
+    {
+      if (!file_.is_open())
+      {
+        return;
+      }
+
+      try
+      {
+        flush();
+      }
+      catch (...)
+      {
+        staging_.clear();
+        file_.close();
+        throw;
+      }
+
+      file_.close();
+    }
+
+    /**
+     * @brief Number of bytes staged but not yet written.
+     */
+    [[nodiscard]] std::size_t buffered() const noexcept { return staging_.size(); }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    [[nodiscard]] bool is_open() const noexcept { return file_.is_open(); }
+
+    [[nodiscard]] const File &file() const noexcept { return file_; }
+
+  private:
+    [[nodiscard]] static FileMode streaming_mode(WriteMode mode)
+    {
+      if (mode == WriteMode::atomic_replace)
+      {
+        throw std::invalid_argument("rix::io::BufferedWriter: atomic_replace is not supported");
+      }
+      return detail::to_file_mode(mode);
+    }
+
+    File file_;
+    Buffer staging_;
+    std::size_t capacity_{0};
+
+    void flush_staging()
+    {
+      if (staging_.empty())
+      {
+        return;
+      }
+
+      file_.write(staging_.span());
+      staging_.clear();
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_BUFFERED_WRITER_HPP
@@ -0,0 +1,168 @@
+/**
+ * @file chunk_reader.hpp
+ * @brief Sequential fixed-size block reader with a single reusable buffer.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_CHUNK_READER_HPP
+#define RIX_IO_CHUNK_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/file.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `ChunkReader`.
+   */
+  struct ChunkReaderOptions
+  {
+    /**
+     * @brief Size of each block in bytes. Must be non-zero.
+     */
+    std::size_t chunk_size{64 * 1024};
+
+    /**
+     * @brief Tell the OS the file is read sequentially (`File::advise(AccessPattern::sequential)`).
+     *
+     * Best-effort: ignored where unsupported.
+     */
+    bool sequential_hint{true};
+  };
+
+  /**
+   * @brief Walk a file in fixed-size blocks through one reusable buffer.
+   *
+   * Memory use is bounded by `chunk_size` regardless of the file size.
+   * Blocks are read with `File::read_at()`, so the file must use `FileBackend::native`.
+   *
+   * @code
+   * rix::io::ChunkReader reader{"data.bin"};
+   * for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+   * {
+   *   consume(chunk);
+   * }
+   * @endcode
+   */
+  class ChunkReader
+  {
+  public:
+    /**
+     * @brief Open `path` for chunked reading.
+     *
+     * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if `options.chunk_size` is zero.
+     */
+    explicit ChunkReader(const std::filesystem::path &path, ChunkReaderOptions options = {})
+        : ChunkReader(File{path, FileMode::read, FileType::binary, FileBackend::native}, options)
+    {
+    }
+
+    /**
+     * @brief Take ownership of an open, readable, native file.
+     *
+     * Reading starts at offset 0.
+     *
+     * @throws std::invalid_argument if the file is unsuitable or `options.chunk_size` is zero.
+     */
+    explicit ChunkReader(File &&file, ChunkReaderOptions options = {})
+        : file_(std::move(file)), buffer_(options.chunk_size)
+    {
+      if (options.chunk_size == 0)
+      {
+        throw std::invalid_argument("rix::io::ChunkReader: chunk_size must be non-zero");
+      }
+
+      if (!file_.is_open() || file_.backend() != FileBackend::native || !detail::mode_can_read(file_.mode()))
+      {
+        throw std::invalid_argument("rix::io::ChunkReader: requires an open readable native file");
+      }
+
+      if (options.sequential_hint)
+      {
+        file_.advise(AccessPattern::sequential);
+      }
+    }
+
+    /**
+     * @brief Read the next block.
+     *
+     * The returned view is valid until the next call to `next()` or destruction.
+     *
+     * @return Up to `chunk_size()` bytes; empty at end of file.
+     * @throws std::runtime_error if reading fails.
+     */
+    [[nodiscard]] std::span<const std::byte> next()
+    {
+      if (eof_)
+      {
+        return {};
+      }
+
+      const std::size_t got = file_.read_at(offset_, buffer_.span());
+      offset_ += got;
+
+      if (got < buffer_.size())
+      {
+        eof_ = true;
+      }
+
+      return std::span<const std::byte>(buffer_.data(), got);
+    }
+
+    /**
+     * @brief Whether end of file has been reached.
+     */
+    [[nodiscard]] bool eof() const noexcept { return eof_; }
+
+    /**
+     * @brief Number of bytes consumed so far.
+     */
+    [[nodiscard]] std::uint64_t offset() const noexcept { return offset_; }
+
+    [[nodiscard]] std::size_t chunk_size() const noexcept { return buffer_.size(); }
+
+    [[nodiscard]] const File &file() const noexcept { return file_; }
+
+  private:
+    File file_;
+    Buffer buffer_;
+    std::uint64_t offset_{0};
+    bool eof_{false};
+  };
+
+  /**
+   * @brief Invoke `fn(std::span<const std::byte>)` for each block of the file at `path`.
+   *
+   * @param path Path to the file.
+   * @param fn Callback receiving each non-empty block.
+   * @param options Block size and read-ahead hint.
+   * @return Total number of bytes read.
+   * @throws std::system_error If opening fails.
+   * @throws std::runtime_error If reading fails.
+   */
+  template <class Fn>
+  inline std::uint64_t for_each_chunk(const std::filesystem::path &path, Fn &&fn, ChunkReaderOptions options = {})
+  {
+    ChunkReader reader{path, options};
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+      fn(chunk);
+    }
+    return reader.offset();
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_CHUNK_READER_HPP
@@ -0,0 +1,626 @@
+/**
+ * @file compression.hpp
+ * @brief Streaming zstd / LZ4 frame compression on top of `File` and `ChunkReader`.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ *
+ * Codecs are optional and enabled at configure time:
+ * - `-DRIX_IO_WITH_ZSTD=ON` defines `RIX_IO_HAS_ZSTD` and links libzstd
+ * - `-DRIX_IO_WITH_LZ4=ON` defines `RIX_IO_HAS_LZ4` and links liblz4
+ *
+ * Without them the types still exist, and using a missing codec throws.
+ */
+
+#ifndef RIX_IO_COMPRESSION_HPP
+#define RIX_IO_COMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/chunk_reader.hpp>
+#include <rix/io/endian.hpp>
+#include <rix/io/file.hpp>
+
+#if defined(RIX_IO_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+#if defined(RIX_IO_HAS_LZ4)
+#include <lz4frame.h>
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Compressed frame formats.
+   */
+  enum class Compression
+  {
+    zstd,
+    lz4
+  };
+
+  /**
+   * @brief Whether support for `codec` was compiled in.
+   */
+  [[nodiscard]] constexpr bool compression_available(Compression codec) noexcept
+  {
+    switch (codec)
+    {
+    case Compression::zstd:
+#if defined(RIX_IO_HAS_ZSTD)
+      return true;
+#else
+      return false;
+#endif
+    case Compression::lz4:
+#if defined(RIX_IO_HAS_LZ4)
+      return true;
+#else
+      return false;
+#endif
+    }
+    return false;
+  }
+
+  /**
+   * @brief Options for `CompressedWriter`.
+   */
+  struct CompressedWriterOptions
+  {
+    Compression codec{Compression::zstd};
+
+    /**
+     * @brief Codec compression level (zstd: 1..22, LZ4: 0 fast .. 12 HC).
+     */
+    int level{3};
+
+    /**
+     * @brief zstd worker threads; 0 compresses on the calling thread.
+     *
+     * Ignored by LZ4, and by zstd builds without multithreading support.
+     */
+    unsigned threads{0};
+
+    /**
+     * @brief Upper bound of uncompressed bytes handed to the codec per call.
+     */
+    std::size_t block_size{128 * 1024};
+  };
+
+  /**
+   * @brief Options for `CompressedReader`.
+   */
+  struct CompressedReaderOptions
+  {
+    /**
+     * @brief Size of the compressed read block and of the decompressed output window.
+     */
+    std::size_t chunk_size{128 * 1024};
+  };
+
+  namespace detail
+  {
+    inline constexpr std::uint32_t zstd_magic = 0xFD2FB528u;
+    inline constexpr std::uint32_t lz4_magic = 0x184D2204u;
+
+    [[noreturn]] inline void throw_codec_missing(const char *who, Compression codec)
+    {
+      throw std::invalid_argument(std::string("rix::io::") + who + ": " +
+                                  (codec == Compression::zstd ? "zstd" : "lz4") + " support is not enabled");
+    }
+
+#if defined(RIX_IO_HAS_ZSTD)
+    struct ZstdCCtxDeleter
+    {
+      void operator()(ZSTD_CCtx *p) const noexcept { ZSTD_freeCCtx(p); }
+    };
+
+    struct ZstdDCtxDeleter
+    {
+      void operator()(ZSTD_DCtx *p) const noexcept { ZSTD_freeDCtx(p); }
+    };
+
+    inline std::size_t zstd_check(std::size_t r, const char *what)
+    {
+      if (ZSTD_isError(r))
+      {
+        throw std::runtime_error(std::string("rix::io: zstd ") + what + " failed: " + ZSTD_getErrorName(r));
+      }
+      return r;
+    }
+#endif
+
+#if defined(RIX_IO_HAS_LZ4)
+    struct Lz4CCtxDeleter
+    {
+      void operator()(LZ4F_cctx *p) const noexcept { LZ4F_freeCompressionContext(p); }
+    };
+
+    struct Lz4DCtxDeleter
+    {
+      void operator()(LZ4F_dctx *p) const noexcept { LZ4F_freeDecompressionContext(p); }
+    };
+
+    inline std::size_t lz4_check(std::size_t r, const char *what)
+    {
+      if (LZ4F_isError(r))
+      {
+        throw std::runtime_error(std::string("rix::io: lz4 ") + what + " failed: " + LZ4F_getErrorName(r));
+      }
+      return r;
+    }
+#endif
+  } // namespace detail
+
+  /**
+   * @brief Streams bytes into a zstd or LZ4 frame file.
+   *
+   * Input is compressed as it arrives; memory use is bounded by the codec
+   * window and one output block, independent of the file size. With zstd and
+   * `threads > 0`, compression runs on libzstd worker threads while the caller
+   * keeps feeding input.
+   *
+   * The frame is finished by `close()` or destruction; a writer destroyed
+   * during unwinding may leave a truncated frame, which `CompressedReader`
+   * rejects.
+   */
+  class CompressedWriter
+  {
+  public:
+    /**
+     * @brief Create or truncate `path` and start a frame.
+     *
+     * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if the codec is not enabled or `block_size` is zero.
+     * @throws std::runtime_error if the codec cannot be initialized.
+     */
+    explicit CompressedWriter(const std::filesystem::path &path, CompressedWriterOptions options = {})
+        : codec_(options.codec),
+          block_size_(options.block_size)
+    {
+      if (!compression_available(codec_))
+      {
+        detail::throw_codec_missing("CompressedWriter", codec_);
+      }
+      if (block_size_ == 0)
+      {
+        throw std::invalid_argument("rix::io::CompressedWriter: block_size must be non-zero");
+      }
+
+      file_ = File{path, FileMode::write, FileType::binary, FileBackend::native};
+      start(options);
+    }
+
+    /**
+     * @brief Finish the frame and close the file.
+     *
+     * Never throws.
+     */
+    ~CompressedWriter() noexcept
+    {
+      try
+      {
+        close();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    CompressedWriter(const CompressedWriter &) = delete;
+    CompressedWriter &operator=(const CompressedWriter &) = delete;
+
+    CompressedWriter(CompressedWriter &&) noexcept = default;
+    CompressedWriter &operator=(CompressedWriter &&) = delete;
+
+    void write(std::string_view text)
+    {
+      write(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    /**
+     * @brief Compress `bytes` into the frame.
+     *
+     * @throws std::runtime_error if the writer is closed, or compressing or writing fails.
+     */
+    void write(std::span<const std::byte> bytes)
+    {
+      if (!file_.is_open())
+      {
+        throw std::runtime_error("rix::io::CompressedWriter: not open");
+      }
+
+      in_total_ += bytes.size();
+      while (!bytes.empty())
+      {
+        const std::size_t n = bytes.size() < block_size_ ? bytes.size() : block_size_;
+        compress(bytes.first(n));
+        bytes = bytes.subspan(n);
+      }
+    }
+
+    /**
+     * @brief Finish the frame and close the file.
+     *
+     * Does nothing if already closed.
+     *
+     * @throws std::runtime_error if finishing fails (the file is closed regardless).
+     */
+    void close()
+    {
+      if (!file_.is_open())
+      {
+        return;
+      }
+
+      try
+      {
+        finish();
+      }
+      catch (...)
+      {
+        file_.close();
+        throw;
+      }
+      file_.close();
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return file_.is_open(); }
+
+    [[nodiscard]] Compression codec() const noexcept { return codec_; }
+
+    /**
+     * @brief Uncompressed bytes accepted so far.
+     */
+    [[nodiscard]] std::uint64_t bytes_in() const noexcept { return in_total_; }
+
+    /**
+     * @brief Compressed bytes written to the file so far.
+     */
+    [[nodiscard]] std::uint64_t bytes_out() const noexcept { return out_total_; }
+
+  private:
+    File file_{};
+    Compression codec_;
+    std::size_t block_size_;
+    UninitializedBuffer out_{};
+    std::uint64_t in_total_{0};
+    std::uint64_t out_total_{0};
+
+#if defined(RIX_IO_HAS_ZSTD)
+    std::unique_ptr<ZSTD_CCtx, detail::ZstdCCtxDeleter> zstd_{};
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+    std::unique_ptr<LZ4F_cctx, detail::Lz4CCtxDeleter> lz4_{};
+    LZ4F_preferences_t lz4_prefs_{};
+#endif
+
+    void emit(std::size_t n)
+    {
+      if (n != 0)
+      {
+        file_.write(std::span<const std::byte>(out_.data(), n));
+        out_total_ += n;
+      }
+    }
+
+    void start([[maybe_unused]] const CompressedWriterOptions &options)
+    {
+#if defined(RIX_IO_HAS_ZSTD)
+      if (codec_ == Compression::zstd)
+      {
+        zstd_.reset(ZSTD_createCCtx());
+        if (!zstd_)
+        {
+          throw std::runtime_error("rix::io::CompressedWriter: zstd context allocation failed");
+        }
+        detail::zstd_check(ZSTD_CCtx_setParameter(zstd_.get(), ZSTD_c_compressionLevel, options.level),
+                           "set level");
+        if (options.threads != 0)
+        {
+          // Fails on single-threaded libzstd builds: keep compressing inline.
+          (void)ZSTD_CCtx_setParameter(zstd_.get(), ZSTD_c_nbWorkers, static_cast<int>(options.threads));
+        }
+        out_.resize_uninitialized(ZSTD_CStreamOutSize());
+        return;
+      }
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+      if (codec_ == Compression::lz4)
+      {
+        LZ4F_cctx *ctx = nullptr;
+        detail::lz4_check(LZ4F_createCompressionContext(&ctx, LZ4F_VERSION), "init");
+        lz4_.reset(ctx);
+        lz4_prefs_.compressionLevel = options.level;
+        lz4_prefs_.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+        out_.resize_uninitialized(LZ4F_compressBound(block_size_, &lz4_prefs_) + LZ4F_HEADER_SIZE_MAX);
+        emit(detail::lz4_check(LZ4F_compressBegin(lz4_.get(), out_.data(), out_.size(), &lz4_prefs_), "begin"));
+        return;
+      }
+#endif
+    }
+
+    void compress([[maybe_unused]] std::span<const std::byte> block)
+    {
+#if defined(RIX_IO_HAS_ZSTD)
+      if (codec_ == Compression::zstd)
+      {
+        ZSTD_inBuffer in{block.data(), block.size(), 0};
+        while (in.pos < in.size)
+        {
+          ZSTD_outBuffer out{out_.data(), out_.size(), 0};
+          detail::zstd_check(ZSTD_compressStream2(zstd_.get(), &out, &in, ZSTD_e_continue), "compress");
+          emit(out.pos);
+        }
+        return;
+      }
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+      if (codec_ == Compression::lz4)
+      {
+        emit(detail::lz4_check(
+            LZ4F_compressUpdate(lz4_.get(), out_.data(), out_.size(), block.data(), block.size(), nullptr),
+            "compress"));
+        return;
+      }
+#endif
+    }
+
+    void finish()
+    {
+#if defined(RIX_IO_HAS_ZSTD)
+      if (codec_ == Compression::zstd)
+      {
+        ZSTD_inBuffer in{nullptr, 0, 0};
+        for (;;)
+        {
+          ZSTD_outBuffer out{out_.data(), out_.size(), 0};
+          const std::size_t left = detail::zstd_check(ZSTD_compressStream2(zstd_.get(), &out, &in, ZSTD_e_end), "end");
+          emit(out.pos);
+          if (left == 0)
+          {
+            break;
+          }
+        }
+      }
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+      if (codec_ == Compression::lz4)
+      {
+        emit(detail::lz4_check(LZ4F_compressEnd(lz4_.get(), out_.data(), out_.size(), nullptr), "end"));
+      }
+#endif
+      file_.flush();
+    }
+  };
+
+  /**
+   * @brief Streams the decompressed content of a zstd or LZ4 frame file.
+   *
+   * The format is detected from the frame magic number. Compressed input is
+   * read through a `ChunkReader`, so at most one compressed block and one
+   * decompressed window are held at a time. Concatenated frames of the same
+   * format are decoded in sequence.
+   */
+  class CompressedReader
+  {
+  public:
+    /**
+     * @brief Open `path` and detect its frame format.
+     *
+     * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if `chunk_size` is zero.
+     * @throws std::runtime_error if the format is unknown or its codec is not enabled.
+     */
+    explicit CompressedReader(const std::filesystem::path &path, CompressedReaderOptions options = {})
+        : input_(path, ChunkReaderOptions{.chunk_size = options.chunk_size})
+    {
+      pending_ = input_.next();
+      if (pending_.size() < 4)
+      {
+        throw std::runtime_error("rix::io::CompressedReader: not a compressed frame: " + path.string());
+      }
+
+      const auto magic = detail::load_endian<std::endian::little, std::uint32_t>(pending_.data());
+      if (magic == detail::zstd_magic)
+      {
+        codec_ = Compression::zstd;
+      }
+      else if (magic == detail::lz4_magic)
+      {
+        codec_ = Compression::lz4;
+      }
+      else
+      {
+        throw std::runtime_error("rix::io::CompressedReader: unknown frame format: " + path.string());
+      }
+
+      if (!compression_available(codec_))
+      {
+        throw std::runtime_error(std::string("rix::io::CompressedReader: ") +
+                                 (codec_ == Compression::zstd ? "zstd" : "lz4") +
+                                 " support is not enabled: " + path.string());
+      }
+
+      out_.resize_uninitialized(options.chunk_size);
+      start();
+    }
+
+    CompressedReader(const CompressedReader &) = delete;
+    CompressedReader &operator=(const CompressedReader &) = delete;
+
+    CompressedReader(CompressedReader &&) noexcept = default;
+    CompressedReader &operator=(CompressedReader &&) noexcept = default;
+
+    [[nodiscard]] Compression codec() const noexcept { return codec_; }
+
+    /**
+     * @brief Decompress the next block.
+     *
+     * The returned view is valid until the next call to `next()` or destruction.
+     *
+     * @return Up to `chunk_size` bytes; empty at end of input.
+     * @throws std::runtime_error if reading fails or the input is corrupt or truncated.
+     */
+    [[nodiscard]] std::span<const std::byte> next()
+    {
+      while (!done_)
+      {
+        if (pending_.empty() && !input_.eof())
+        {
+          pending_ = input_.next();
+        }
+
+        // A finished frame with no input left: calling the decoder again
+        // would only ask for the next frame header.
+        if (!frame_open_ && pending_.empty() && input_.eof())
+        {
+          done_ = true;
+          break;
+        }
+
+        const std::size_t produced = decompress();
+        if (produced != 0)
+        {
+          return std::span<const std::byte>(out_.data(), produced);
+        }
+
+        if (pending_.empty() && input_.eof())
+        {
+          if (frame_open_)
+          {
+            throw std::runtime_error("rix::io::CompressedReader: truncated frame");
+          }
+          done_ = true;
+        }
+      }
+      return {};
+    }
+
+  private:
+    ChunkReader input_;
+    std::span<const std::byte> pending_{};
+    UninitializedBuffer out_{};
+    Compression codec_{Compression::zstd};
+    bool frame_open_{true};
+    bool done_{false};
+
+#if defined(RIX_IO_HAS_ZSTD)
+    std::unique_ptr<ZSTD_DCtx, detail::ZstdDCtxDeleter> zstd_{};
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+    std::unique_ptr<LZ4F_dctx, detail::Lz4DCtxDeleter> lz4_{};
+#endif
+
+    void start()
+    {
+#if defined(RIX_IO_HAS_ZSTD)
+      if (codec_ == Compression::zstd)
+      {
+        zstd_.reset(ZSTD_createDCtx());
+        if (!zstd_)
+        {
+          throw std::runtime_error("rix::io::CompressedReader: zstd context allocation failed");
+        }
+      }
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+      if (codec_ == Compression::lz4)
+      {
+        LZ4F_dctx *ctx = nullptr;
+        detail::lz4_check(LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION), "init");
+        lz4_.reset(ctx);
+      }
+#endif
+    }
+
+    /**
+     * @brief Feed `pending_` to the decoder; return the number of bytes produced in `out_`.
+     */
+    std::size_t decompress()
+    {
+#if defined(RIX_IO_HAS_ZSTD)
+      if (codec_ == Compression::zstd)
+      {
+        ZSTD_inBuffer in{pending_.data(), pending_.size(), 0};
+        ZSTD_outBuffer out{out_.data(), out_.size(), 0};
+        const std::size_t hint = detail::zstd_check(ZSTD_decompressStream(zstd_.get(), &out, &in), "decompress");
+        pending_ = pending_.subspan(in.pos);
+        if (in.pos != 0 || out.pos != 0)
+        {
+          frame_open_ = hint != 0;
+        }
+        return out.pos;
+      }
+#endif
+#if defined(RIX_IO_HAS_LZ4)
+      if (codec_ == Compression::lz4)
+      {
+        std::size_t dst = out_.size();
+        std::size_t src = pending_.size();
+        const std::size_t hint = detail::lz4_check(
+            LZ4F_decompress(lz4_.get(), out_.data(), &dst, pending_.data(), &src, nullptr), "decompress");
+        pending_ = pending_.subspan(src);
+        if (src != 0 || dst != 0)
+        {
+          frame_open_ = hint != 0;
+        }
+        return dst;
+      }
+#endif
+      return 0;
+    }
+  };
+
+  /**
+   * @brief Decompress a whole zstd or LZ4 frame file.
+   *
+   * Only the decompressed result and one compressed block are held in memory.
+   *
+   * @throws std::system_error If opening fails.
+   * @throws std::runtime_error If reading or decompressing fails.
+   */
+  [[nodiscard]] inline std::vector<std::byte> read_file_decompressed(const std::filesystem::path &path,
+                                                                     CompressedReaderOptions options = {})
+  {
+    std::vector<std::byte> out;
+    CompressedReader reader{path, options};
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+      out.insert(out.end(), chunk.begin(), chunk.end());
+    }
+    return out;
+  }
+
+  /**
+   * @brief Compress `bytes` into a new frame file at `path`.
+   *
+   * @throws std::system_error If opening fails.
+   * @throws std::invalid_argument If the codec is not enabled.
+   * @throws std::runtime_error If compressing or writing fails.
+   */
+  inline void write_file_compressed(const std::filesystem::path &path,
+                                    std::span<const std::byte> bytes,
+                                    CompressedWriterOptions options = {})
+  {
+    CompressedWriter writer{path, options};
+    writer.write(bytes);
+    writer.close();
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_COMPRESSION_HPP
@@ -0,0 +1,175 @@
+/**
+ * @file endian.hpp
+ * @brief Byte order conversion helpers for portable binary formats.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_ENDIAN_HPP
+#define RIX_IO_ENDIAN_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace rix::io
+{
+  static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                "rix::io: mixed-endian hosts are not supported");
+
+  /**
+   * @brief Types with a defined byte order: integers (except `bool`), enums and floating point.
+   */
+  template <class T>
+  concept EndianScalar = (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+                         std::is_enum_v<T> || std::is_floating_point_v<T>;
+
+  namespace detail
+  {
+    template <std::size_t N>
+    struct unsigned_of_size;
+
+    template <>
+    struct unsigned_of_size<1>
+    {
+      using type = std::uint8_t;
+    };
+
+    template <>
+    struct unsigned_of_size<2>
+    {
+      using type = std::uint16_t;
+    };
+
+    template <>
+    struct unsigned_of_size<4>
+    {
+      using type = std::uint32_t;
+    };
+
+    template <>
+    struct unsigned_of_size<8>
+    {
+      using type = std::uint64_t;
+    };
+
+    template <std::unsigned_integral U>
+    [[nodiscard]] constexpr U byte_swap_unsigned(U v) noexcept
+    {
+      if constexpr (sizeof(U) == 1)
+      {
+        return v;
+      }
+#if defined(__GNUC__) || defined(__clang__)
+      else if constexpr (sizeof(U) == 2)
+      {
+        return __builtin_bswap16(v);
+      }
+      else if constexpr (sizeof(U) == 4)
+      {
+        return __builtin_bswap32(v);
+      }
+      else if constexpr (sizeof(U) == 8)
+      {
+        return __builtin_bswap64(v);
+      }
+#endif
+      else
+      {
+        U out = 0;
+        for (std::size_t i = 0; i < sizeof(U); ++i)
+        {
+          out = static_cast<U>((out << 8) | (v & 0xFFu));
+          v = static_cast<U>(v >> 8);
+        }
+        return out;
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @brief Reverse the byte order of `v`.
+   *
+   * Named `byte_swap` rather than `byteswap` to stay clear of C++23 `std::byteswap`.
+   */
+  template <EndianScalar T>
+  [[nodiscard]] constexpr T byte_swap(T v) noexcept
+  {
+    using U = typename detail::unsigned_of_size<sizeof(T)>::type;
+    return std::bit_cast<T>(detail::byte_swap_unsigned(std::bit_cast<U>(v)));
+  }
+
+  /**
+   * @brief Convert between native and `order` byte order (the operation is its own inverse).
+   */
+  template <std::endian Order, EndianScalar T>
+  [[nodiscard]] constexpr T convert_endian(T v) noexcept
+  {
+    if constexpr (Order == std::endian::native)
+    {
+      return v;
+    }
+    else
+    {
+      return byte_swap(v);
+    }
+  }
+
+  /**
+   * @brief Reverse the byte order of every element in place.
+   *
+   * Written as a plain loop so the compiler can vectorize it into shuffles.
+   */
+  template <EndianScalar T>
+  void byte_swap_inplace(std::span<T> values) noexcept
+  {
+    for (auto &v : values)
+    {
+      v = byte_swap(v);
+    }
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief Encode `values` in `Order` byte order into `out` (`values.size() * sizeof(T)` bytes).
+     */
+    template <std::endian Order, EndianScalar T>
+    void store_endian(std::byte *out, std::span<const T> values) noexcept
+    {
+      if constexpr (Order == std::endian::native || sizeof(T) == 1)
+      {
+        if (!values.empty())
+        {
+          std::memcpy(out, values.data(), values.size_bytes());
+        }
+      }
+      else
+      {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+          const T v = byte_swap(values[i]);
+          std::memcpy(out + i * sizeof(T), &v, sizeof(T));
+        }
+      }
+    }
+
+    template <std::endian Order, EndianScalar T>
+    [[nodiscard]] T load_endian(const std::byte *in) noexcept
+    {
+      T v{};
+      std::memcpy(&v, in, sizeof(T));
+      return convert_endian<Order>(v);
+    }
+  } // namespace detail
+
+} // namespace rix::io
+
+#endif // RIX_IO_ENDIAN_HPP
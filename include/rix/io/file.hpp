@@ -13,16 +13,22 @@
 
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
-#include <iterator>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <type_traits>
 #include <vector>
 
+#include <rix/io/access_pattern.hpp>
+#include <rix/io/buffer.hpp>
+#include <rix/io/native_handle.hpp>
+
 namespace rix::io
 {
   /**
@@ -47,6 +53,53 @@ namespace rix::io
     binary
   };
 
+  /**
+   * @brief Implementation used by `File` to talk to the operating system.
+   *
+   * - `stream`: `std::fstream` (default, honours `FileType::text` translation)
+   * - `native`: raw descriptor / HANDLE (`open`/`read`/`write`, Win32 equivalents),
+   *   no userspace buffering, no newline translation, errors carry the OS error code
+   */
+  enum class FileBackend
+  {
+    stream,
+    native
+  };
+
+  /**
+   * @brief Optional open flags, combinable with `|`.
+   *
+   * - `direct`: bypass the OS page cache (`O_DIRECT` on Linux, `F_NOCACHE` on
+   *   macOS, `FILE_FLAG_NO_BUFFERING` on Windows). Requires `FileBackend::native`.
+   *   Offsets, sizes and buffer addresses of `read_at()` / `write_at()` should be
+   *   multiples of `direct_io_alignment` (see `AlignedBuffer`); whole-file reads
+   *   throw `std::invalid_argument` on direct files.
+   * - `exclusive`: create the file, failing with `std::errc::file_exists` if it
+   *   already exists (`O_CREAT | O_EXCL`, `CREATE_NEW`), in any mode. Requires
+   *   `FileBackend::native`.
+   */
+  enum class FileFlags : unsigned
+  {
+    none = 0,
+    direct = 1u << 0,
+    exclusive = 1u << 1
+  };
+
+  [[nodiscard]] constexpr FileFlags operator|(FileFlags a, FileFlags b) noexcept
+  {
+    return static_cast<FileFlags>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+  }
+
+  [[nodiscard]] constexpr FileFlags operator&(FileFlags a, FileFlags b) noexcept
+  {
+    return static_cast<FileFlags>(static_cast<unsigned>(a) & static_cast<unsigned>(b));
+  }
+
+  [[nodiscard]] constexpr bool has_flag(FileFlags set, FileFlags flag) noexcept
+  {
+    return (set & flag) == flag && flag != FileFlags::none;
+  }
+
   namespace detail
   {
     inline std::ios_base::openmode to_openmode(FileMode mode, FileType type)
@@ -77,6 +130,34 @@ namespace rix::io
       return m;
     }
 
+    [[nodiscard]] inline NativeOpenOptions to_native_options(FileMode mode) noexcept
+    {
+      NativeOpenOptions o{};
+
+      switch (mode)
+      {
+      case FileMode::read:
+        o.read = true;
+        break;
+      case FileMode::write:
+        o.write = true;
+        o.create = true;
+        o.truncate = true;
+        break;
+      case FileMode::append:
+        o.write = true;
+        o.create = true;
+        o.append = true;
+        break;
+      case FileMode::read_write:
+        o.read = true;
+        o.write = true;
+        break;
+      }
+
+      return o;
+    }
+
     [[nodiscard]] inline bool mode_can_read(FileMode m) noexcept
     {
       return (m == FileMode::read || m == FileMode::read_write);
@@ -86,16 +167,44 @@ namespace rix::io
     {
       return (m == FileMode::write || m == FileMode::append || m == FileMode::read_write);
     }
+
+    /**
+     * @brief Resize `out` to `n` elements that the caller overwrites immediately.
+     *
+     * Skips zero-filling where the container allows it: `BasicBuffer` defers to
+     * its allocator, `std::string` uses `resize_and_overwrite` when available.
+     * `std::vector` with the default allocator always zero-fills.
+     */
+    template <class Container>
+    void resize_for_overwrite(Container &out, std::size_t n)
+    {
+      if constexpr (requires { out.resize_uninitialized(n); })
+      {
+        out.resize_uninitialized(n);
+      }
+#if defined(__cpp_lib_string_resize_and_overwrite)
+      else if constexpr (std::is_same_v<Container, std::string>)
+      {
+        out.resize_and_overwrite(n, [](char *, std::size_t len) noexcept
+                                 { return len; });
+      }
+#endif
+      else
+      {
+        out.resize(n);
+      }
+    }
   } // namespace detail
 
   /**
-   * @brief RAII wrapper around `std::fstream` with explicit mode checks.
+   * @brief RAII wrapper around `std::fstream` or a native handle with explicit mode checks.
    *
    * Opens a file on construction and closes it on destruction.
    *
    * Error reporting:
    * - Open errors: `std::system_error` with `errno`
-   * - Operation errors: `std::runtime_error`
+   * - Operation errors: `std::runtime_error` (`std::system_error` carrying
+   *   the OS error code for `FileBackend::native`)
    */
   class File
   {
@@ -106,13 +215,22 @@ namespace rix::io
     File() = default;
 
     /**
-     * @brief Open a file at `path` using `mode` and `type`.
+     * @brief Open a file at `path` using `mode`, `type`, `backend` and `flags`.
      *
      * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if `flags` require `FileBackend::native` and another backend is used.
      */
-    File(const std::filesystem::path &path, FileMode mode, FileType type = FileType::text)
-        : path_(path), mode_(mode), type_(type)
+    File(const std::filesystem::path &path,
+         FileMode mode,
+         FileType type = FileType::text,
+         FileBackend backend = FileBackend::stream,
+         FileFlags flags = FileFlags::none)
+        : path_(path), mode_(mode), type_(type), backend_(backend), flags_(flags)
     {
+      if (flags_ != FileFlags::none && !is_native())
+      {
+        throw std::invalid_argument("rix::io::File: open flags require FileBackend::native");
+      }
       open_internal();
     }
 
@@ -132,8 +250,11 @@ namespace rix::io
     File(File &&other) noexcept
         : path_(std::move(other.path_)),
           stream_(std::move(other.stream_)),
+          native_(std::move(other.native_)),
           mode_(other.mode_),
-          type_(other.type_)
+          type_(other.type_),
+          backend_(other.backend_),
+          flags_(other.flags_)
     {
       other.path_.clear();
     }
@@ -148,8 +269,11 @@ namespace rix::io
         close();
         path_ = std::move(other.path_);
         stream_ = std::move(other.stream_);
+        native_ = std::move(other.native_);
         mode_ = other.mode_;
         type_ = other.type_;
+        backend_ = other.backend_;
+        flags_ = other.flags_;
         other.path_.clear();
       }
       return *this;
@@ -158,7 +282,10 @@ namespace rix::io
     /**
      * @brief Whether the underlying stream is open.
      */
-    [[nodiscard]] bool is_open() const noexcept { return stream_.is_open(); }
+    [[nodiscard]] bool is_open() const noexcept
+    {
+      return is_native() ? native_.is_open() : stream_.is_open();
+    }
 
     /**
      * @brief Convenience boolean conversion (same as `is_open()`).
@@ -180,6 +307,30 @@ namespace rix::io
      */
     [[nodiscard]] FileType type() const noexcept { return type_; }
 
+    /**
+     * @brief Backend used for opening.
+     */
+    [[nodiscard]] FileBackend backend() const noexcept { return backend_; }
+
+    /**
+     * @brief Open flags.
+     */
+    [[nodiscard]] FileFlags flags() const noexcept { return flags_; }
+
+    /**
+     * @brief Underlying descriptor (POSIX) or HANDLE (Windows).
+     *
+     * Ownership is not transferred. Requires `FileBackend::native`.
+     *
+     * @throws std::runtime_error if the file is not open or not native.
+     */
+    [[nodiscard]] detail::native_handle_type native_handle() const
+    {
+      require_open();
+      require_native("native_handle");
+      return native_.get();
+    }
+
     /**
      * @brief Close the file if open.
      *
@@ -187,6 +338,8 @@ namespace rix::io
      */
     void close() noexcept
     {
+      native_.close();
+
       if (stream_.is_open())
       {
         try
@@ -202,22 +355,46 @@ namespace rix::io
     /**
      * @brief Read entire file as text.
      *
-     * The stream is rewound before reading.
+     * The stream is rewound before reading. When the size is known, the string is
+     * sized once and filled with a single bulk read; non-seekable sources (pipes,
+     * procfs) fall back to chunked reads until end of file.
      *
      * @throws std::runtime_error if the file is not open or not readable, or if reading fails.
+     * @throws std::invalid_argument if the file was opened with `FileFlags::direct`.
      */
     [[nodiscard]] std::string read_all_text()
     {
       require_open();
       require_readable();
 
+      if (is_native())
+      {
+        std::string content;
+        require_buffered("read_all_text");
+        read_native_all(content, "read_all_text");
+        return content;
+      }
+
+      std::string content;
+
       stream_.clear();
+      stream_.seekg(0, std::ios::end);
+      const std::streampos end = stream_.tellg();
       stream_.seekg(0, std::ios::beg);
+      const std::streampos begin = stream_.tellg();
 
-      std::string content;
-      content.assign(std::istreambuf_iterator<char>(stream_), std::istreambuf_iterator<char>());
+      if (stream_ && end != std::streampos(-1) && begin != std::streampos(-1) && end > begin)
+      {
+        // In text mode the byte size is an upper bound of the characters read.
+        read_stream_sized(content, static_cast<std::size_t>(end - begin));
+      }
+
+      // Picks up whatever the size did not account for (procfs reports 0,
+      // pipes cannot seek, files may grow). Costs one extra read at EOF.
+      stream_.clear(stream_.rdstate() & ~std::ios::failbit);
+      read_stream_tail(content);
 
-      if (!stream_.eof() && stream_.fail())
+      if (stream_.bad() || (!stream_.eof() && stream_.fail()))
       {
         throw std::runtime_error("rix::io::File: read_all_text failed: " + path_.string());
       }
@@ -231,39 +408,58 @@ namespace rix::io
      * The stream is rewound before reading.
      *
      * @throws std::runtime_error if the file is not open or not readable, or if reading fails.
+     * @throws std::invalid_argument if the file was opened with `FileFlags::direct`.
      */
     [[nodiscard]] std::vector<std::byte> read_all_bytes()
     {
       require_open();
       require_readable();
 
-      stream_.clear();
-      stream_.seekg(0, std::ios::end);
-      const std::streampos end = stream_.tellg();
-      stream_.seekg(0, std::ios::beg);
-      const std::streampos begin = stream_.tellg();
+      std::vector<std::byte> buffer;
 
-      if (end < begin)
+      if (is_native())
       {
-        throw std::runtime_error("rix::io::File: invalid size: " + path_.string());
+        require_buffered("read_all_bytes");
+        read_native_all(buffer, "read_all_bytes");
       }
-
-      const auto size = static_cast<std::size_t>(end - begin);
-      std::vector<std::byte> buffer(size);
-
-      if (size != 0)
+      else
       {
-        stream_.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(size));
-
-        if (static_cast<std::size_t>(stream_.gcount()) != size || stream_.fail())
-        {
-          throw std::runtime_error("rix::io::File: read_all_bytes failed: " + path_.string());
-        }
+        read_stream_all(buffer, "read_all_bytes");
       }
 
       return buffer;
     }
 
+    /**
+     * @brief Read entire file into an existing buffer.
+     *
+     * `out` is cleared first and its capacity is reused, so repeated reads of
+     * similarly sized files do not allocate once the buffer has grown.
+     *
+     * The stream is rewound before reading.
+     *
+     * @throws std::runtime_error if the file is not open or not readable, or if reading fails.
+     * @throws std::invalid_argument if the file was opened with `FileFlags::direct`.
+     */
+    template <class Allocator>
+    void read_all_into(BasicBuffer<Allocator> &out)
+    {
+      require_open();
+      require_readable();
+
+      out.clear();
+
+      if (is_native())
+      {
+        require_buffered("read_all_into");
+        read_native_all(out, "read_all_into");
+      }
+      else
+      {
+        read_stream_all(out, "read_all_into");
+      }
+    }
+
     /**
      * @brief Write text to file.
      *
@@ -274,6 +470,12 @@ namespace rix::io
       require_open();
       require_writable();
 
+      if (is_native())
+      {
+        write_native(reinterpret_cast<const std::byte *>(text.data()), text.size(), "write(text)");
+        return;
+      }
+
       stream_.write(text.data(), static_cast<std::streamsize>(text.size()));
       if (!stream_)
       {
@@ -291,6 +493,12 @@ namespace rix::io
       require_open();
       require_writable();
 
+      if (is_native())
+      {
+        write_native(bytes.data(), bytes.size(), "write(bytes)");
+        return;
+      }
+
       if (!bytes.empty())
       {
         stream_.write(reinterpret_cast<const char *>(bytes.data()),
@@ -303,15 +511,313 @@ namespace rix::io
       }
     }
 
+    /**
+     * @brief Gather-write several byte ranges, in order, with as few calls as possible.
+     *
+     * With `FileBackend::native` this maps to `writev` on POSIX, so a multi-part
+     * record goes out in a single system call without being concatenated first.
+     *
+     * @throws std::runtime_error if the file is not open or not writable, or if writing fails.
+     */
+    void write(std::span<const std::span<const std::byte>> parts)
+    {
+      require_open();
+      require_writable();
+
+      if (is_native())
+      {
+        std::error_code ec;
+        detail::write_all_gather(native_, parts, ec);
+        if (ec)
+        {
+          throw_native(ec, "write(parts)");
+        }
+        return;
+      }
+
+      for (const auto &part : parts)
+      {
+        if (!part.empty())
+        {
+          stream_.write(reinterpret_cast<const char *>(part.data()),
+                        static_cast<std::streamsize>(part.size()));
+        }
+      }
+
+      if (!stream_)
+      {
+        throw std::runtime_error("rix::io::File: write(parts) failed: " + path_.string());
+      }
+    }
+
+    /**
+     * @brief Scatter-read into several byte ranges, in order, from the current position.
+     *
+     * With `FileBackend::native` this maps to `readv` on POSIX.
+     *
+     * @return Total number of bytes read; less than the combined size only at end of file.
+     * @throws std::runtime_error if the file is not open or not readable, or if reading fails.
+     */
+    [[nodiscard]] std::size_t read(std::span<const std::span<std::byte>> parts)
+    {
+      require_open();
+      require_readable();
+
+      if (is_native())
+      {
+        std::error_code ec;
+        const std::size_t got = detail::read_full_scatter(native_, parts, ec);
+        if (ec)
+        {
+          throw_native(ec, "read(parts)");
+        }
+        return got;
+      }
+
+      std::size_t total = 0;
+      for (const auto &part : parts)
+      {
+        if (part.empty())
+        {
+          continue;
+        }
+
+        stream_.read(reinterpret_cast<char *>(part.data()), static_cast<std::streamsize>(part.size()));
+        const auto got = static_cast<std::size_t>(stream_.gcount());
+        total += got;
+
+        if (got < part.size())
+        {
+          break;
+        }
+      }
+
+      if (stream_.bad())
+      {
+        throw std::runtime_error("rix::io::File: read(parts) failed: " + path_.string());
+      }
+
+      return total;
+    }
+
+    /**
+     * @brief Read up to `out.size()` bytes starting at `offset` (pread semantics).
+     *
+     * Does not use or move the file position, so several threads may read
+     * different regions of the same open file concurrently. On Windows the
+     * position is saved and restored around each call; it is only guaranteed
+     * to be unchanged when no other thread uses the same `File` at the time.
+     * Requires `FileBackend::native`.
+     *
+     * @return Number of bytes read; less than `out.size()` only at end of file.
+     * @throws std::runtime_error if the file is not open, not readable, not native, or if reading fails.
+     */
+    [[nodiscard]] std::size_t read_at(std::uint64_t offset, std::span<std::byte> out)
+    {
+      require_open();
+      require_readable();
+      require_native("read_at");
+
+      std::size_t total = 0;
+      while (total < out.size())
+      {
+        std::error_code ec;
+        const std::size_t got = native_.read_some_at(out.data() + total, out.size() - total, offset + total, ec);
+        if (ec)
+        {
+          throw_native(ec, "read_at");
+        }
+        if (got == 0)
+        {
+          break;
+        }
+        total += got;
+      }
+
+      return total;
+    }
+
+    /**
+     * @brief Write all of `bytes` starting at `offset` (pwrite semantics).
+     *
+     * Does not use or move the file position, so several threads may write
+     * disjoint regions of the same open file concurrently. On Windows the
+     * position is restored as described for `read_at()`.
+     * Requires `FileBackend::native`. With `FileMode::append`, POSIX systems
+     * ignore `offset` and append.
+     *
+     * @throws std::runtime_error if the file is not open, not writable, not native, or if writing fails.
+     */
+    void write_at(std::uint64_t offset, std::span<const std::byte> bytes)
+    {
+      require_open();
+      require_writable();
+      require_native("write_at");
+
+      std::size_t total = 0;
+      while (total < bytes.size())
+      {
+        std::error_code ec;
+        const std::size_t put = native_.write_some_at(bytes.data() + total, bytes.size() - total, offset + total, ec);
+        if (ec)
+        {
+          throw_native(ec, "write_at");
+        }
+        if (put == 0)
+        {
+          throw_native(std::make_error_code(std::errc::io_error), "write_at");
+        }
+        total += put;
+      }
+    }
+
+    /**
+     * @brief Tell the OS how `[offset, offset + len)` will be accessed (`len == 0`: to end of file).
+     *
+     * Maps to `posix_fadvise` (`F_RDAHEAD` / `F_RDADVISE` on macOS). Best-effort;
+     * Windows only accepts such hints at open time. Requires `FileBackend::native`.
+     *
+     * @return false if the hint is unsupported or was rejected.
+     * @throws std::runtime_error if the file is not open or not native.
+     */
+    bool advise(AccessPattern pattern, std::uint64_t offset = 0, std::uint64_t len = 0)
+    {
+      require_open();
+      require_native("advise");
+      return native_.advise(pattern, offset, len);
+    }
+
+    /**
+     * @brief Start loading `[offset, offset + len)` into the page cache (`len == 0`: to end of file).
+     *
+     * Returns immediately; a later read of the range then avoids blocking on
+     * the device. Maps to `readahead` on Linux and `F_RDADVISE` on macOS.
+     * Requires `FileBackend::native`.
+     *
+     * @return false if prefetching is unsupported or was rejected.
+     * @throws std::runtime_error if the file is not open or not native.
+     */
+    bool prefetch(std::uint64_t offset = 0, std::uint64_t len = 0)
+    {
+      require_open();
+      require_native("prefetch");
+      return native_.prefetch(offset, len);
+    }
+
+    /**
+     * @brief Reserve disk space so the file can grow to `size` bytes without further allocation.
+     *
+     * The visible file size is unchanged, so appends still start at the current
+     * end. Reserving extents up front gives a more contiguous layout and fewer
+     * metadata updates during large sequential writes. Requires `FileBackend::native`.
+     *
+     * @return false if the platform or filesystem does not support preallocation.
+     * @throws std::runtime_error if the file is not open, not writable or not native.
+     * @throws std::system_error if preallocation fails (e.g. out of space).
+     */
+    bool preallocate(std::uint64_t size)
+    {
+      require_open();
+      require_writable();
+      require_native("preallocate");
+
+      std::error_code ec;
+      const bool done = native_.preallocate(size, ec);
+      if (ec)
+      {
+        throw_native(ec, "preallocate");
+      }
+      return done;
+    }
+
+    /**
+     * @brief Release the storage of `[offset, offset + len)`; the range then reads as zeros.
+     *
+     * The file size is unchanged. Requires `FileBackend::native`.
+     *
+     * @return false if the platform or filesystem cannot punch holes (range left unchanged).
+     * @throws std::runtime_error if the file is not open, not writable or not native.
+     * @throws std::system_error if the operation fails.
+     */
+    bool punch_hole(std::uint64_t offset, std::uint64_t len)
+    {
+      require_open();
+      require_writable();
+      require_native("punch_hole");
+
+      std::error_code ec;
+      const bool done = native_.punch_hole(offset, len, ec);
+      if (ec)
+      {
+        throw_native(ec, "punch_hole");
+      }
+      return done;
+    }
+
+    /**
+     * @brief Current file size in bytes.
+     *
+     * Requires `FileBackend::native`.
+     *
+     * @throws std::runtime_error if the file is not open, not native, or if the size cannot be queried.
+     */
+    [[nodiscard]] std::uint64_t size()
+    {
+      require_open();
+      require_native("size");
+
+      std::error_code ec;
+      const std::uint64_t n = native_.size(ec);
+      if (ec)
+      {
+        throw_native(ec, "size");
+      }
+      return n;
+    }
+
+    /**
+     * @brief Flush written data and metadata to stable storage (`fsync`).
+     *
+     * Requires `FileBackend::native`: the stream backend has no descriptor to sync.
+     *
+     * @throws std::runtime_error if the file is not open or not native.
+     * @throws std::system_error if syncing fails.
+     */
+    void sync()
+    {
+      sync_internal(false, "sync");
+    }
+
+    /**
+     * @brief Flush written data to stable storage, skipping non-essential metadata (`fdatasync`).
+     *
+     * Requires `FileBackend::native`.
+     *
+     * @throws std::runtime_error if the file is not open or not native.
+     * @throws std::system_error if syncing fails.
+     */
+    void sync_data()
+    {
+      sync_internal(true, "sync_data");
+    }
+
     /**
      * @brief Flush the underlying stream.
      *
+     * No-op for `FileBackend::native`, which has no userspace buffer.
+     * Data is handed to the OS but not forced to disk; see `sync()`.
+     *
      * @throws std::runtime_error if flushing fails.
      */
     void flush()
     {
       require_open();
 
+      if (is_native())
+      {
+        return;
+      }
+
       stream_.flush();
       if (!stream_)
       {
@@ -322,11 +828,30 @@ namespace rix::io
   private:
     std::filesystem::path path_{};
     std::fstream stream_{};
+    detail::NativeHandle native_{};
     FileMode mode_{FileMode::read};
     FileType type_{FileType::text};
+    FileBackend backend_{FileBackend::stream};
+    FileFlags flags_{FileFlags::none};
+
+    [[nodiscard]] bool is_native() const noexcept { return backend_ == FileBackend::native; }
 
     void open_internal()
     {
+      if (is_native())
+      {
+        std::error_code ec;
+        detail::NativeOpenOptions opts = detail::to_native_options(mode_);
+        opts.direct = has_flag(flags_, FileFlags::direct);
+        opts.exclusive = has_flag(flags_, FileFlags::exclusive);
+        native_.open(path_, opts, ec);
+        if (ec)
+        {
+          throw std::system_error(ec, "rix::io::File: open failed: " + path_.string());
+        }
+        return;
+      }
+
       stream_.open(path_, detail::to_openmode(mode_, type_));
 
       if (!stream_.is_open())
@@ -335,14 +860,193 @@ namespace rix::io
       }
     }
 
+    /**
+     * @brief Read from offset 0 to the size reported by the stream.
+     */
+    template <class Container>
+    void read_stream_all(Container &out, const char *what)
+    {
+      stream_.clear();
+      stream_.seekg(0, std::ios::end);
+      const std::streampos end = stream_.tellg();
+      stream_.seekg(0, std::ios::beg);
+      const std::streampos begin = stream_.tellg();
+
+      if (end < begin)
+      {
+        throw std::runtime_error("rix::io::File: invalid size: " + path_.string());
+      }
+
+      const auto size = static_cast<std::size_t>(end - begin);
+      detail::resize_for_overwrite(out, size);
+
+      if (size != 0)
+      {
+        stream_.read(reinterpret_cast<char *>(out.data()), static_cast<std::streamsize>(size));
+
+        if (static_cast<std::size_t>(stream_.gcount()) != size || stream_.fail())
+        {
+          throw std::runtime_error(std::string("rix::io::File: ") + what + " failed: " + path_.string());
+        }
+      }
+    }
+
+    /**
+     * @brief Read up to `size` characters into `out` with one bulk read.
+     */
+    void read_stream_sized(std::string &out, std::size_t size)
+    {
+#if defined(__cpp_lib_string_resize_and_overwrite)
+      out.resize_and_overwrite(size, [this](char *p, std::size_t n)
+                               {
+                                 stream_.read(p, static_cast<std::streamsize>(n));
+                                 return static_cast<std::size_t>(stream_.gcount()); });
+#else
+      out.resize(size);
+      stream_.read(out.data(), static_cast<std::streamsize>(size));
+      out.resize(static_cast<std::size_t>(stream_.gcount()));
+#endif
+    }
+
+    /**
+     * @brief Append the remaining stream content to `out` in fixed-size chunks.
+     */
+    void read_stream_tail(std::string &out)
+    {
+      if (stream_.eof())
+      {
+        return;
+      }
+
+      char chunk[4096];
+      for (;;)
+      {
+        stream_.read(chunk, static_cast<std::streamsize>(sizeof(chunk)));
+        const auto got = static_cast<std::size_t>(stream_.gcount());
+        out.append(chunk, got);
+
+        if (!stream_)
+        {
+          break;
+        }
+      }
+    }
+
+    [[noreturn]] void throw_native(const std::error_code &ec, const char *what) const
+    {
+      throw std::system_error(ec, std::string("rix::io::File: ") + what + " failed: " + path_.string());
+    }
+
+    /**
+     * @brief Read from offset 0 to end of file through the native handle.
+     *
+     * The reported size is only a hint: reading continues until end of file,
+     * so files whose size is unknown up front (procfs, growing files) are read entirely.
+     */
+    template <class Container>
+    void read_native_all(Container &out, const char *what)
+    {
+      std::error_code ec;
+      native_.seek(0, ec);
+      if (ec)
+      {
+        throw_native(ec, what);
+      }
+
+      const std::uint64_t hint = native_.size(ec);
+      if (ec)
+      {
+        throw_native(ec, what);
+      }
+
+      detail::resize_for_overwrite(out, static_cast<std::size_t>(hint));
+      std::size_t total = 0;
+
+      for (;;)
+      {
+        std::size_t got = 0;
+
+        if (total < out.size())
+        {
+          auto *p = reinterpret_cast<std::byte *>(out.data());
+          got = native_.read_some(p + total, out.size() - total, ec);
+        }
+        else
+        {
+          // Size hint exhausted: probe with a small chunk before growing.
+          std::byte chunk[4096];
+          got = native_.read_some(chunk, sizeof(chunk), ec);
+          if (!ec && got != 0)
+          {
+            detail::resize_for_overwrite(out, total + got);
+            std::memcpy(reinterpret_cast<std::byte *>(out.data()) + total, chunk, got);
+          }
+        }
+
+        if (ec)
+        {
+          throw_native(ec, what);
+        }
+        if (got == 0)
+        {
+          break;
+        }
+        total += got;
+      }
+
+      out.resize(total);
+    }
+
+    void sync_internal(bool data_only, const char *what)
+    {
+      require_open();
+      require_native(what);
+
+      std::error_code ec;
+      native_.sync(data_only, ec);
+      if (ec)
+      {
+        throw_native(ec, what);
+      }
+    }
+
+    void write_native(const std::byte *p, std::size_t n, const char *what)
+    {
+      std::error_code ec;
+      detail::write_all(native_, p, n, ec);
+      if (ec)
+      {
+        throw_native(ec, what);
+      }
+    }
+
     void require_open() const
     {
-      if (!stream_.is_open())
+      if (!is_open())
       {
         throw std::runtime_error("rix::io::File: not open: " + path_.string());
       }
     }
 
+    void require_native(const char *what) const
+    {
+      if (!is_native())
+      {
+        throw std::runtime_error(std::string("rix::io::File: ") + what + " requires FileBackend::native: " + path_.string());
+      }
+    }
+
+    void require_buffered(const char *what) const
+    {
+      if (has_flag(flags_, FileFlags::direct))
+      {
+        throw std::invalid_argument(std::string("rix::io::File: ") + what +
+                                    " is not supported on FileFlags::direct files, use read_at() with an "
+                                    "AlignedBuffer: " +
+                                    path_.string());
+      }
+    }
+
     void require_readable() const
     {
       if (!detail::mode_can_read(mode_))
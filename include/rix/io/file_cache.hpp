@@ -0,0 +1,280 @@
+/**
+ * @file file_cache.hpp
+ * @brief Thread-safe cache of whole-file contents, revalidated with `stat`.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_FILE_CACHE_HPP
+#define RIX_IO_FILE_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/reader.hpp>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `FileCache`.
+   */
+  struct FileCacheOptions
+  {
+    /**
+     * @brief Total bytes of file content kept across all shards.
+     *
+     * Each shard gets an equal share; a file larger than one share is
+     * returned but never cached.
+     */
+    std::size_t max_bytes{64 * 1024 * 1024};
+
+    /**
+     * @brief Number of independently locked LRU shards (at least 1).
+     */
+    std::size_t shards{16};
+  };
+
+  /**
+   * @brief Hit and miss counters of a `FileCache`.
+   */
+  struct FileCacheStats
+  {
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::size_t entries{0};
+    std::size_t bytes{0};
+  };
+
+  /**
+   * @brief Byte-budgeted LRU cache of file contents keyed by path.
+   *
+   * `get()` returns a shared immutable buffer. Every lookup costs one `stat`:
+   * an entry is reused only while size, modification time and inode (device
+   * and inode on POSIX) are unchanged, so replaced or rewritten files are
+   * reloaded. Changes that keep all three identical are not detected.
+   *
+   * Paths are hashed to one of `shards` LRU lists with their own mutex, so
+   * concurrent readers only contend when they hit the same shard. Files are
+   * read outside the lock; two threads missing the same path may both read it.
+   */
+  class FileCache
+  {
+  public:
+    explicit FileCache(FileCacheOptions options = {})
+        : shards_(options.shards == 0 ? 1 : options.shards),
+          shard_budget_(options.max_bytes / shards_.size())
+    {
+    }
+
+    FileCache(const FileCache &) = delete;
+    FileCache &operator=(const FileCache &) = delete;
+
+    /**
+     * @brief Content of the file at `path`, from the cache when still current.
+     *
+     * @throws std::system_error If opening fails.
+     * @throws std::runtime_error If reading fails.
+     */
+    [[nodiscard]] std::shared_ptr<const Buffer> get(const std::filesystem::path &path)
+    {
+      Key key = path.native();
+      Shard &shard = shard_for(key);
+
+      Stamp stamp{};
+      const bool stamped = stat_stamp(path, stamp);
+
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end())
+        {
+          if (stamped && it->second->stamp == stamp)
+          {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            ++shard.hits;
+            return it->second->content;
+          }
+          shard.erase(it);
+        }
+        ++shard.misses;
+      }
+
+      auto content = std::make_shared<Buffer>();
+      read_file_into(path, *content);
+
+      // A file that changed while being read gets the pre-read stamp, so the
+      // next lookup sees a mismatch and reloads it.
+      if (stamped && content->size() <= shard_budget_)
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        insert(shard, std::move(key), stamp, content);
+      }
+      return content;
+    }
+
+    /**
+     * @brief Drop the entry for `path`, if any.
+     */
+    void invalidate(const std::filesystem::path &path)
+    {
+      const Key key = path.native();
+      Shard &shard = shard_for(key);
+
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.index.find(key);
+      if (it != shard.index.end())
+      {
+        shard.erase(it);
+      }
+    }
+
+    /**
+     * @brief Drop every entry. Counters are kept.
+     */
+    void clear()
+    {
+      for (Shard &shard : shards_)
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.clear();
+        shard.lru.clear();
+        shard.bytes = 0;
+      }
+    }
+
+    /**
+     * @brief Snapshot of the counters summed over all shards.
+     */
+    [[nodiscard]] FileCacheStats stats() const
+    {
+      FileCacheStats out{};
+      for (const Shard &shard : shards_)
+      {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        out.hits += shard.hits;
+        out.misses += shard.misses;
+        out.entries += shard.index.size();
+        out.bytes += shard.bytes;
+      }
+      return out;
+    }
+
+  private:
+    using Key = std::filesystem::path::string_type;
+
+    struct Stamp
+    {
+      std::uint64_t size{0};
+      std::int64_t mtime_ns{0};
+      std::uint64_t device{0};
+      std::uint64_t inode{0};
+
+      friend bool operator==(const Stamp &, const Stamp &) = default;
+    };
+
+    struct Entry
+    {
+      Key key;
+      Stamp stamp;
+      std::shared_ptr<const Buffer> content;
+    };
+
+    struct Shard
+    {
+      mutable std::mutex mutex;
+      std::list<Entry> lru;
+      std::unordered_map<Key, std::list<Entry>::iterator> index;
+      std::size_t bytes{0};
+      std::uint64_t hits{0};
+      std::uint64_t misses{0};
+
+      void erase(std::unordered_map<Key, std::list<Entry>::iterator>::iterator it)
+      {
+        bytes -= it->second->content->size();
+        lru.erase(it->second);
+        index.erase(it);
+      }
+    };
+
+    std::vector<Shard> shards_;
+    std::size_t shard_budget_;
+
+    Shard &shard_for(const Key &key) { return shards_[std::hash<Key>{}(key) % shards_.size()]; }
+
+    void insert(Shard &shard, Key key, const Stamp &stamp, std::shared_ptr<const Buffer> content)
+    {
+      auto it = shard.index.find(key);
+      if (it != shard.index.end())
+      {
+        shard.erase(it);
+      }
+
+      const std::size_t n = content->size();
+      while (!shard.lru.empty() && shard.bytes + n > shard_budget_)
+      {
+        shard.erase(shard.index.find(shard.lru.back().key));
+      }
+
+      shard.lru.push_front(Entry{key, stamp, std::move(content)});
+      shard.index.emplace(std::move(key), shard.lru.begin());
+      shard.bytes += n;
+    }
+
+    static bool stat_stamp(const std::filesystem::path &path, Stamp &out) noexcept
+    {
+#if defined(_WIN32)
+      std::error_code ec;
+      const auto size = std::filesystem::file_size(path, ec);
+      if (ec)
+      {
+        return false;
+      }
+      const auto mtime = std::filesystem::last_write_time(path, ec);
+      if (ec)
+      {
+        return false;
+      }
+      out.size = static_cast<std::uint64_t>(size);
+      out.mtime_ns = static_cast<std::int64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count());
+      return true;
+#else
+      struct ::stat st{};
+      if (::stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+      {
+        return false;
+      }
+      out.size = static_cast<std::uint64_t>(st.st_size);
+#if defined(__APPLE__)
+      out.mtime_ns = static_cast<std::int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+      out.mtime_ns = static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+      out.device = static_cast<std::uint64_t>(st.st_dev);
+      out.inode = static_cast<std::uint64_t>(st.st_ino);
+      return true;
+#endif
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_FILE_CACHE_HPP
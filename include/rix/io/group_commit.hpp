@@ -0,0 +1,268 @@
+/**
+ * @file group_commit.hpp
+ * @brief Share one durability flush between many concurrent writers.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_GROUP_COMMIT_HPP
+#define RIX_IO_GROUP_COMMIT_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <rix/io/file.hpp>
+#include <rix/io/native_handle.hpp>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `GroupCommit`.
+   */
+  struct GroupCommitOptions
+  {
+    /**
+     * @brief How long the first caller of a batch waits for others to join.
+     */
+    std::chrono::microseconds window{200};
+
+    /**
+     * @brief Batch size that triggers the flush before the window elapses.
+     */
+    std::size_t max_batch{64};
+  };
+
+  /**
+   * @brief Batches durability requests from concurrent writers.
+   *
+   * The first caller becomes the batch leader: it waits up to `window` for
+   * other callers to join, then flushes on behalf of all of them while they
+   * block. On Linux, files are flushed with one `syncfs` per filesystem
+   * instead of one `fdatasync` per file; elsewhere each file is synced by the
+   * leader. Directory syncs are deduplicated per directory in every batch.
+   *
+   * `syncfs` also flushes unrelated dirty data on the same filesystem; the
+   * trade-off pays off when many small files are committed together.
+   */
+  class GroupCommit
+  {
+  public:
+    explicit GroupCommit(GroupCommitOptions options = {})
+        : options_(options)
+    {
+    }
+
+    GroupCommit(const GroupCommit &) = delete;
+    GroupCommit &operator=(const GroupCommit &) = delete;
+
+    /**
+     * @brief Block until the written data of `file` is on stable storage.
+     *
+     * @throws std::runtime_error if the file is not open or not native.
+     * @throws std::system_error if syncing fails.
+     */
+    void sync(File &file)
+    {
+      Request req;
+      req.handle = file.native_handle();
+      submit(req);
+      if (req.ec)
+      {
+        throw std::system_error(req.ec, "rix::io::GroupCommit: sync failed: " + file.path().string());
+      }
+    }
+
+    /**
+     * @brief Block until entry changes in `dir` (e.g. a rename) are durable.
+     *
+     * @throws std::system_error if syncing fails.
+     */
+    void sync_directory(const std::filesystem::path &dir)
+    {
+      Request req;
+      req.directory = dir;
+      req.is_directory = true;
+      submit(req);
+      if (req.ec)
+      {
+        throw std::system_error(req.ec, "rix::io::GroupCommit: directory sync failed: " + dir.string());
+      }
+    }
+
+  private:
+    struct Request
+    {
+      detail::native_handle_type handle{};
+      std::filesystem::path directory{};
+      bool is_directory{false};
+      std::error_code ec{};
+    };
+
+    struct Batch
+    {
+      std::vector<Request *> requests;
+      bool done{false};
+    };
+
+    GroupCommitOptions options_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::shared_ptr<Batch> open_{};
+    bool leader_active_{false};
+
+    void submit(Request &req)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!open_)
+      {
+        open_ = std::make_shared<Batch>();
+      }
+
+      const std::shared_ptr<Batch> batch = open_;
+      batch->requests.push_back(&req);
+      if (batch->requests.size() >= options_.max_batch)
+      {
+        cv_.notify_all();
+      }
+
+      for (;;)
+      {
+        if (batch->done)
+        {
+          return;
+        }
+
+        // A batch is closed and completed by its leader before leader_active_
+        // is cleared, so an unfinished batch without a leader is still open.
+        if (!leader_active_)
+        {
+          lead(lock, *batch);
+          return;
+        }
+
+        cv_.wait(lock);
+      }
+    }
+
+    void lead(std::unique_lock<std::mutex> &lock, Batch &batch)
+    {
+      leader_active_ = true;
+      cv_.wait_for(lock, options_.window, [this, &batch]
+                   { return batch.requests.size() >= options_.max_batch; });
+      open_.reset();
+
+      lock.unlock();
+      try
+      {
+        flush(batch.requests);
+      }
+      catch (...)
+      {
+        for (Request *r : batch.requests)
+        {
+          r->ec = std::make_error_code(std::errc::not_enough_memory);
+        }
+      }
+      lock.lock();
+
+      batch.done = true;
+      leader_active_ = false;
+      cv_.notify_all();
+    }
+
+    static void flush(const std::vector<Request *> &requests)
+    {
+      const std::size_t n = requests.size();
+
+#if defined(__linux__)
+      // One syncfs covers every file of the same filesystem: key files by device.
+      std::vector<dev_t> devices(n, 0);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        struct ::stat st{};
+        if (!requests[i]->is_directory && ::fstat(requests[i]->handle, &st) == 0)
+        {
+          devices[i] = st.st_dev;
+        }
+      }
+#endif
+
+      auto covers = [&](std::size_t a, std::size_t b)
+      {
+        const Request &ra = *requests[a];
+        const Request &rb = *requests[b];
+        if (ra.is_directory || rb.is_directory)
+        {
+          return ra.is_directory && rb.is_directory && ra.directory == rb.directory;
+        }
+#if defined(__linux__)
+        return devices[a] != 0 && devices[a] == devices[b];
+#else
+        return ra.handle == rb.handle;
+#endif
+      };
+
+      std::vector<std::size_t> owner(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        owner[i] = i;
+        for (std::size_t j = 0; j < i; ++j)
+        {
+          if (owner[j] == j && covers(j, i))
+          {
+            owner[i] = j;
+            break;
+          }
+        }
+
+        if (owner[i] != i)
+        {
+          continue;
+        }
+
+        Request &r = *requests[i];
+        if (r.is_directory)
+        {
+          detail::sync_directory(r.directory, r.ec);
+        }
+        else
+        {
+#if defined(__linux__)
+          if (::syncfs(r.handle) != 0)
+          {
+            r.ec = detail::last_os_error();
+          }
+#else
+          detail::sync_native(r.handle, true, r.ec);
+#endif
+        }
+      }
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (owner[i] != i)
+        {
+          requests[i]->ec = requests[owner[i]]->ec;
+        }
+      }
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_GROUP_COMMIT_HPP
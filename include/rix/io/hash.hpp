@@ -0,0 +1,517 @@
+/**
+ * @file hash.hpp
+ * @brief Streaming CRC32C and XXH64 checksums, and hashing stream adapters.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_HASH_HPP
+#define RIX_IO_HASH_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+#include <rix/io/buffered_writer.hpp>
+#include <rix/io/chunk_reader.hpp>
+#include <rix/io/endian.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <nmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+// x86-64 builds without -msse4.2 pick the crc32 instruction at run time.
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(__SSE4_2__)
+#define RIX_IO_CRC32C_DISPATCH 1
+#else
+#define RIX_IO_CRC32C_DISPATCH 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RIX_IO_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define RIX_IO_TARGET_SSE42
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Checksum algorithms available to `Hasher` and `hash_file()`.
+   *
+   * - `crc32c`: CRC-32/Castagnoli, as used by iSCSI, ext4 and many storage
+   *   formats. On x86-64 the SSE4.2 `crc32` instruction is used whenever the
+   *   CPU has it, detected once at run time (or unconditionally with
+   *   `-msse4.2`). On ARM the CRC instructions are used when the target
+   *   enables them (`-march=armv8-a+crc`). Otherwise a slicing-by-8 table.
+   * - `xxh64`: 64-bit xxHash, a fast non-cryptographic hash.
+   */
+  enum class HashAlgorithm
+  {
+    crc32c,
+    xxh64
+  };
+
+  namespace detail
+  {
+    inline constexpr std::uint32_t crc32c_poly = 0x82F63B78u;
+
+    [[nodiscard]] consteval std::array<std::array<std::uint32_t, 256>, 8> make_crc32c_tables() noexcept
+    {
+      std::array<std::array<std::uint32_t, 256>, 8> t{};
+      for (std::uint32_t i = 0; i < 256; ++i)
+      {
+        std::uint32_t c = i;
+        for (int k = 0; k < 8; ++k)
+        {
+          c = (c >> 1) ^ ((c & 1u) ? crc32c_poly : 0u);
+        }
+        t[0][i] = c;
+      }
+      for (std::size_t s = 1; s < 8; ++s)
+      {
+        for (std::size_t i = 0; i < 256; ++i)
+        {
+          t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFFu];
+        }
+      }
+      return t;
+    }
+
+    inline constexpr auto crc32c_tables = make_crc32c_tables();
+
+    /**
+     * @brief Portable slicing-by-8 CRC32C over a raw (non-inverted) state.
+     */
+    [[nodiscard]] inline std::uint32_t crc32c_table(std::uint32_t c, std::span<const std::byte> bytes) noexcept
+    {
+      const std::byte *p = bytes.data();
+      std::size_t n = bytes.size();
+      const auto &t = crc32c_tables;
+
+      for (; n >= 8; p += 8, n -= 8)
+      {
+        const std::uint32_t lo = load_endian<std::endian::little, std::uint32_t>(p) ^ c;
+        const std::uint32_t hi = load_endian<std::endian::little, std::uint32_t>(p + 4);
+        c = t[7][lo & 0xFFu] ^ t[6][(lo >> 8) & 0xFFu] ^ t[5][(lo >> 16) & 0xFFu] ^ t[4][lo >> 24] ^
+            t[3][hi & 0xFFu] ^ t[2][(hi >> 8) & 0xFFu] ^ t[1][(hi >> 16) & 0xFFu] ^ t[0][hi >> 24];
+      }
+      for (; n != 0; ++p, --n)
+      {
+        c = (c >> 8) ^ t[0][(c ^ static_cast<std::uint32_t>(*p)) & 0xFFu];
+      }
+      return c;
+    }
+
+#if defined(__x86_64__) || defined(_M_X64)
+    /**
+     * @brief CRC32C with the SSE4.2 `crc32` instruction. Only call when the CPU supports it.
+     */
+    [[nodiscard]] RIX_IO_TARGET_SSE42 inline std::uint32_t crc32c_sse42(std::uint32_t c,
+                                                                        std::span<const std::byte> bytes) noexcept
+    {
+      const std::byte *p = bytes.data();
+      std::size_t n = bytes.size();
+
+      std::uint64_t c64 = c;
+      for (; n >= 8; p += 8, n -= 8)
+      {
+        c64 = _mm_crc32_u64(c64, load_endian<std::endian::little, std::uint64_t>(p));
+      }
+      c = static_cast<std::uint32_t>(c64);
+      for (; n != 0; ++p, --n)
+      {
+        c = _mm_crc32_u8(c, static_cast<std::uint8_t>(*p));
+      }
+      return c;
+    }
+#endif
+
+#if RIX_IO_CRC32C_DISPATCH
+    [[nodiscard]] inline bool cpu_has_sse42() noexcept
+    {
+      static const bool has = []
+      {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4]{};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+      }();
+      return has;
+    }
+#endif
+
+    /**
+     * @brief Advance a raw (non-inverted) CRC32C state over `bytes`.
+     */
+    [[nodiscard]] inline std::uint32_t crc32c_raw(std::uint32_t c, std::span<const std::byte> bytes) noexcept
+    {
+#if RIX_IO_CRC32C_DISPATCH
+      return cpu_has_sse42() ? crc32c_sse42(c, bytes) : crc32c_table(c, bytes);
+#elif defined(__x86_64__) || defined(_M_X64)
+      return crc32c_sse42(c, bytes);
+#elif defined(__ARM_FEATURE_CRC32)
+      const std::byte *p = bytes.data();
+      std::size_t n = bytes.size();
+      for (; n >= 8; p += 8, n -= 8)
+      {
+        c = __crc32cd(c, load_endian<std::endian::little, std::uint64_t>(p));
+      }
+      for (; n != 0; ++p, --n)
+      {
+        c = __crc32cb(c, static_cast<std::uint8_t>(*p));
+      }
+      return c;
+#else
+      return crc32c_table(c, bytes);
+#endif
+    }
+
+    inline constexpr std::uint64_t xxh_p1 = 0x9E3779B185EBCA87ull;
+    inline constexpr std::uint64_t xxh_p2 = 0xC2B2AE3D27D4EB4Full;
+    inline constexpr std::uint64_t xxh_p3 = 0x165667B19E3779F9ull;
+    inline constexpr std::uint64_t xxh_p4 = 0x85EBCA77C2B2AE63ull;
+    inline constexpr std::uint64_t xxh_p5 = 0x27D4EB2F165667C5ull;
+
+    [[nodiscard]] constexpr std::uint64_t xxh64_round(std::uint64_t acc, std::uint64_t input) noexcept
+    {
+      return std::rotl(acc + input * xxh_p2, 31) * xxh_p1;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t xxh64_merge(std::uint64_t h, std::uint64_t acc) noexcept
+    {
+      return (h ^ xxh64_round(0, acc)) * xxh_p1 + xxh_p4;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Incremental CRC32C.
+   */
+  class Crc32c
+  {
+  public:
+    void update(std::span<const std::byte> bytes) noexcept { state_ = detail::crc32c_raw(state_, bytes); }
+
+    void update(std::string_view text) noexcept
+    {
+      update(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    [[nodiscard]] std::uint32_t value() const noexcept { return ~state_; }
+
+    void reset() noexcept { state_ = ~std::uint32_t{0}; }
+
+  private:
+    std::uint32_t state_{~std::uint32_t{0}};
+  };
+
+  /**
+   * @brief Incremental XXH64.
+   *
+   * Input is consumed in 32-byte stripes over four independent lanes; bytes
+   * that do not fill a stripe are kept until the next `update()` or `value()`.
+   */
+  class Xxh64
+  {
+  public:
+    explicit Xxh64(std::uint64_t seed = 0) noexcept { reset(seed); }
+
+    void update(std::span<const std::byte> bytes) noexcept
+    {
+      const std::byte *p = bytes.data();
+      std::size_t n = bytes.size();
+      total_ += n;
+
+      if (pending_ != 0)
+      {
+        const std::size_t take = n < 32 - pending_ ? n : 32 - pending_;
+        std::memcpy(stripe_.data() + pending_, p, take);
+        pending_ += take;
+        p += take;
+        n -= take;
+        if (pending_ < 32)
+        {
+          return;
+        }
+        consume(stripe_.data());
+        pending_ = 0;
+      }
+
+      for (; n >= 32; p += 32, n -= 32)
+      {
+        consume(p);
+      }
+
+      if (n != 0)
+      {
+        std::memcpy(stripe_.data(), p, n);
+        pending_ = n;
+      }
+    }
+
+    void update(std::string_view text) noexcept
+    {
+      update(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept
+    {
+      using namespace detail;
+
+      std::uint64_t h = 0;
+      if (total_ >= 32)
+      {
+        h = std::rotl(v_[0], 1) + std::rotl(v_[1], 7) + std::rotl(v_[2], 12) + std::rotl(v_[3], 18);
+        for (const std::uint64_t v : v_)
+        {
+          h = xxh64_merge(h, v);
+        }
+      }
+      else
+      {
+        h = seed_ + xxh_p5;
+      }
+      h += total_;
+
+      const std::byte *p = stripe_.data();
+      std::size_t n = pending_;
+      for (; n >= 8; p += 8, n -= 8)
+      {
+        h ^= xxh64_round(0, load_endian<std::endian::little, std::uint64_t>(p));
+        h = std::rotl(h, 27) * xxh_p1 + xxh_p4;
+      }
+      if (n >= 4)
+      {
+        h ^= static_cast<std::uint64_t>(load_endian<std::endian::little, std::uint32_t>(p)) * xxh_p1;
+        h = std::rotl(h, 23) * xxh_p2 + xxh_p3;
+        p += 4;
+        n -= 4;
+      }
+      for (; n != 0; ++p, --n)
+      {
+        h ^= static_cast<std::uint64_t>(*p) * xxh_p5;
+        h = std::rotl(h, 11) * xxh_p1;
+      }
+
+      h ^= h >> 33;
+      h *= xxh_p2;
+      h ^= h >> 29;
+      h *= xxh_p3;
+      h ^= h >> 32;
+      return h;
+    }
+
+    void reset(std::uint64_t seed = 0) noexcept
+    {
+      seed_ = seed;
+      v_ = {seed + detail::xxh_p1 + detail::xxh_p2, seed + detail::xxh_p2, seed, seed - detail::xxh_p1};
+      total_ = 0;
+      pending_ = 0;
+    }
+
+  private:
+    std::array<std::uint64_t, 4> v_{};
+    std::array<std::byte, 32> stripe_{};
+    std::uint64_t seed_{0};
+    std::uint64_t total_{0};
+    std::size_t pending_{0};
+
+    void consume(const std::byte *p) noexcept
+    {
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        v_[i] = detail::xxh64_round(v_[i], detail::load_endian<std::endian::little, std::uint64_t>(p + 8 * i));
+      }
+    }
+  };
+
+  /**
+   * @brief Incremental hash with the algorithm chosen at runtime.
+   *
+   * `digest()` returns the CRC32C value zero-extended to 64 bits, or the XXH64 value.
+   */
+  class Hasher
+  {
+  public:
+    explicit Hasher(HashAlgorithm algorithm = HashAlgorithm::crc32c) noexcept
+        : algorithm_(algorithm)
+    {
+    }
+
+    [[nodiscard]] HashAlgorithm algorithm() const noexcept { return algorithm_; }
+
+    void update(std::span<const std::byte> bytes) noexcept
+    {
+      if (algorithm_ == HashAlgorithm::crc32c)
+      {
+        crc_.update(bytes);
+      }
+      else
+      {
+        xxh_.update(bytes);
+      }
+    }
+
+    void update(std::string_view text) noexcept
+    {
+      update(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    [[nodiscard]] std::uint64_t digest() const noexcept
+    {
+      return algorithm_ == HashAlgorithm::crc32c ? crc_.value() : xxh_.value();
+    }
+
+    void reset() noexcept
+    {
+      crc_.reset();
+      xxh_.reset();
+    }
+
+  private:
+    HashAlgorithm algorithm_;
+    Crc32c crc_{};
+    Xxh64 xxh_{};
+  };
+
+  /**
+   * @brief CRC32C of `bytes`.
+   */
+  [[nodiscard]] inline std::uint32_t crc32c(std::span<const std::byte> bytes) noexcept
+  {
+    Crc32c h;
+    h.update(bytes);
+    return h.value();
+  }
+
+  /**
+   * @brief XXH64 of `bytes` with `seed`.
+   */
+  [[nodiscard]] inline std::uint64_t xxh64(std::span<const std::byte> bytes, std::uint64_t seed = 0) noexcept
+  {
+    Xxh64 h{seed};
+    h.update(bytes);
+    return h.value();
+  }
+
+  /**
+   * @brief `Hasher` digest of `bytes`.
+   */
+  [[nodiscard]] inline std::uint64_t hash_bytes(std::span<const std::byte> bytes,
+                                                HashAlgorithm algorithm = HashAlgorithm::crc32c) noexcept
+  {
+    Hasher h{algorithm};
+    h.update(bytes);
+    return h.digest();
+  }
+
+  /**
+   * @brief `ChunkReader` that hashes every block it returns.
+   *
+   * Wraps an existing reader; the digest covers all bytes returned so far.
+   */
+  class HashingChunkReader
+  {
+  public:
+    explicit HashingChunkReader(ChunkReader &reader, HashAlgorithm algorithm = HashAlgorithm::crc32c) noexcept
+        : reader_(reader),
+          hasher_(algorithm)
+    {
+    }
+
+    /**
+     * @brief Same as `ChunkReader::next()`.
+     *
+     * @throws std::runtime_error If reading fails.
+     */
+    [[nodiscard]] std::span<const std::byte> next()
+    {
+      const auto chunk = reader_.next();
+      hasher_.update(chunk);
+      return chunk;
+    }
+
+    [[nodiscard]] std::uint64_t digest() const noexcept { return hasher_.digest(); }
+
+    [[nodiscard]] ChunkReader &reader() noexcept { return reader_; }
+
+  private:
+    ChunkReader &reader_;
+    Hasher hasher_;
+  };
+
+  /**
+   * @brief `BufferedWriter` front end that hashes every byte written through it.
+   */
+  class HashingWriter
+  {
+  public:
+    explicit HashingWriter(BufferedWriter &writer, HashAlgorithm algorithm = HashAlgorithm::crc32c) noexcept
+        : writer_(writer),
+          hasher_(algorithm)
+    {
+    }
+
+    /**
+     * @brief Hash `bytes` and pass them to `BufferedWriter::write()`.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void write(std::span<const std::byte> bytes)
+    {
+      hasher_.update(bytes);
+      writer_.write(bytes);
+    }
+
+    void write(std::string_view text)
+    {
+      write(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    [[nodiscard]] std::uint64_t digest() const noexcept { return hasher_.digest(); }
+
+    [[nodiscard]] BufferedWriter &writer() noexcept { return writer_; }
+
+  private:
+    BufferedWriter &writer_;
+    Hasher hasher_;
+  };
+
+  /**
+   * @brief Hash the file at `path` in one streaming pass.
+   *
+   * @param path Path to the file.
+   * @param algorithm Checksum to compute.
+   * @param options Block size and read-ahead hint.
+   * @throws std::system_error If opening fails.
+   * @throws std::runtime_error If reading fails.
+   */
+  [[nodiscard]] inline std::uint64_t hash_file(const std::filesystem::path &path,
+                                               HashAlgorithm algorithm = HashAlgorithm::crc32c,
+                                               ChunkReaderOptions options = {})
+  {
+    Hasher h{algorithm};
+    for_each_chunk(path, [&h](std::span<const std::byte> chunk)
+                   { h.update(chunk); }, options);
+    return h.digest();
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_HASH_HPP
@@ -0,0 +1,488 @@
+/**
+ * @file inline_buffer.hpp
+ * @brief Byte buffer with inline storage for small payloads.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_INLINE_BUFFER_HPP
+#define RIX_IO_INLINE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <rix/io/endian.hpp>
+#include <rix/io/varint.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Contiguous byte buffer storing up to `N` bytes without allocating.
+   *
+   * Mirrors the `Buffer` interface for spans, text, POD, endian and varint
+   * helpers. Content beyond `N` bytes moves to a heap block that is kept
+   * until `reset()` or destruction.
+   */
+  template <std::size_t N>
+  class InlineBuffer
+  {
+    static_assert(N > 0, "InlineBuffer requires a non-zero inline capacity");
+
+  public:
+    using value_type = std::byte;
+    using size_type = std::size_t;
+
+    static constexpr size_type inline_capacity = N;
+
+    InlineBuffer() noexcept = default;
+
+    explicit InlineBuffer(std::string_view text) { assign(text); }
+
+    explicit InlineBuffer(std::span<const std::byte> bytes) { assign(bytes); }
+
+    ~InlineBuffer() noexcept { release_heap(); }
+
+    InlineBuffer(const InlineBuffer &other) { assign(other.span()); }
+
+    InlineBuffer &operator=(const InlineBuffer &other)
+    {
+      if (this != &other)
+      {
+        assign(other.span());
+      }
+      return *this;
+    }
+
+    InlineBuffer(InlineBuffer &&other) noexcept { take(other); }
+
+    InlineBuffer &operator=(InlineBuffer &&other) noexcept
+    {
+      if (this != &other)
+      {
+        release_heap();
+        take(other);
+      }
+      return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief True while the content lives in the inline storage.
+     */
+    [[nodiscard]] bool is_inline() const noexcept { return heap_ == nullptr; }
+
+    [[nodiscard]] std::byte *data() noexcept { return heap_ ? heap_ : inline_; }
+
+    [[nodiscard]] const std::byte *data() const noexcept { return heap_ ? heap_ : inline_; }
+
+    [[nodiscard]] std::span<std::byte> span() noexcept { return std::span<std::byte>(data(), size_); }
+
+    [[nodiscard]] std::span<const std::byte> span() const noexcept
+    {
+      return std::span<const std::byte>(data(), size_);
+    }
+
+    /**
+     * @brief Unchecked byte access.
+     */
+    [[nodiscard]] std::byte &operator[](size_type i) noexcept { return data()[i]; }
+
+    /**
+     * @brief Unchecked byte access.
+     */
+    [[nodiscard]] const std::byte &operator[](size_type i) const noexcept { return data()[i]; }
+
+    /**
+     * @brief Checked byte access.
+     *
+     * @throws std::out_of_range if index is invalid.
+     */
+    [[nodiscard]] std::byte &at(size_type i)
+    {
+      check_index(i);
+      return data()[i];
+    }
+
+    /**
+     * @brief Checked byte access.
+     *
+     * @throws std::out_of_range if index is invalid.
+     */
+    [[nodiscard]] const std::byte &at(size_type i) const
+    {
+      check_index(i);
+      return data()[i];
+    }
+
+    /**
+     * @brief Zero-copy view as string bytes.
+     */
+    [[nodiscard]] std::string_view as_string_view() const noexcept
+    {
+      return std::string_view(reinterpret_cast<const char *>(data()), size_);
+    }
+
+    [[nodiscard]] std::string to_string() const { return std::string(as_string_view()); }
+
+    void clear() noexcept { size_ = 0; }
+
+    /**
+     * @brief Clear and return to inline storage, freeing any heap block.
+     */
+    void reset() noexcept
+    {
+      release_heap();
+      size_ = 0;
+    }
+
+    void reserve(size_type cap)
+    {
+      if (cap > capacity_)
+      {
+        grow_to(cap);
+      }
+    }
+
+    /**
+     * @brief Resize; new bytes are zeroed.
+     */
+    void resize(size_type size)
+    {
+      const size_type old = size_;
+      resize_uninitialized(size);
+      if (size > old)
+      {
+        std::memset(data() + old, 0, size - old);
+      }
+    }
+
+    /**
+     * @brief Resize for bytes the caller is about to overwrite; new bytes are indeterminate.
+     */
+    void resize_uninitialized(size_type size)
+    {
+      reserve(size);
+      size_ = size;
+    }
+
+    void assign(std::string_view text)
+    {
+      clear();
+      append(text);
+    }
+
+    void assign(std::span<const std::byte> bytes)
+    {
+      clear();
+      append(bytes);
+    }
+
+    void append(std::string_view text) { append_raw(text.data(), text.size()); }
+
+    void append(std::span<const std::byte> bytes) { append_raw(bytes.data(), bytes.size()); }
+
+    void push_back(std::byte b) { append_raw(&b, 1); }
+
+    void append_byte(unsigned char b) { push_back(static_cast<std::byte>(b)); }
+
+    /**
+     * @brief Append a trivially copyable value as raw bytes (native endianness).
+     */
+    template <class T>
+    void append_pod(const T &value)
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "append_pod requires trivially copyable type");
+      append_raw(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Read a trivially copyable value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <class T>
+    [[nodiscard]] T read_pod(size_type offset) const
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "read_pod requires trivially copyable type");
+
+      if (offset > size_ || (size_ - offset) < sizeof(T))
+      {
+        throw std::invalid_argument("rix::io::InlineBuffer::read_pod: out of range");
+      }
+
+      T out{};
+      std::memcpy(&out, data() + offset, sizeof(T));
+      return out;
+    }
+
+    /**
+     * @brief Overwrite a trivially copyable value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <class T>
+    void write_pod(size_type offset, const T &value)
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "write_pod requires trivially copyable type");
+
+      if (offset > size_ || (size_ - offset) < sizeof(T))
+      {
+        throw std::invalid_argument("rix::io::InlineBuffer::write_pod: out of range");
+      }
+
+      std::memcpy(data() + offset, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Append a value encoded little-endian.
+     */
+    template <EndianScalar T>
+    void append_le(T value)
+    {
+      append_pod(convert_endian<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Append a value encoded big-endian.
+     */
+    template <EndianScalar T>
+    void append_be(T value)
+    {
+      append_pod(convert_endian<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Append every value of `values` encoded little-endian.
+     */
+    template <EndianScalar T>
+    void append_array_le(std::span<const T> values)
+    {
+      append_array_endian<std::endian::little>(values);
+    }
+
+    /**
+     * @brief Append every value of `values` encoded big-endian.
+     */
+    template <EndianScalar T>
+    void append_array_be(std::span<const T> values)
+    {
+      append_array_endian<std::endian::big>(values);
+    }
+
+    /**
+     * @brief Read a little-endian value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_le(size_type offset) const
+    {
+      return convert_endian<std::endian::little>(read_pod<T>(offset));
+    }
+
+    /**
+     * @brief Read a big-endian value at offset.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    [[nodiscard]] T read_be(size_type offset) const
+    {
+      return convert_endian<std::endian::big>(read_pod<T>(offset));
+    }
+
+    /**
+     * @brief Overwrite a value at offset, encoded little-endian.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    void write_le(size_type offset, T value)
+    {
+      write_pod(offset, convert_endian<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Overwrite a value at offset, encoded big-endian.
+     *
+     * @throws std::invalid_argument if out of range.
+     */
+    template <EndianScalar T>
+    void write_be(size_type offset, T value)
+    {
+      write_pod(offset, convert_endian<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Append `value` as an unsigned LEB128 varint (1 to 10 bytes).
+     */
+    void append_varint(std::uint64_t value)
+    {
+      std::byte tmp[max_varint_size];
+      append_raw(tmp, encode_varint(value, tmp));
+    }
+
+    /**
+     * @brief Append `value` ZigZag-mapped then LEB128-encoded.
+     */
+    void append_varint_signed(std::int64_t value) { append_varint(zigzag_encode(value)); }
+
+    /**
+     * @brief Append the varint length of `text` followed by its bytes.
+     */
+    void append_length_prefixed(std::string_view text)
+    {
+      append_length_prefixed(std::as_bytes(std::span<const char>(text.data(), text.size())));
+    }
+
+    /**
+     * @brief Append the varint length of `bytes` followed by the bytes.
+     */
+    void append_length_prefixed(std::span<const std::byte> bytes)
+    {
+      std::byte tmp[max_varint_size];
+      const std::size_t n = encode_varint(bytes.size(), tmp);
+
+      const auto *src = static_cast<const std::byte *>(reserve_for_append(n + bytes.size(), bytes.data()));
+      append_raw(tmp, n);
+      append_raw(src, bytes.size());
+    }
+
+  private:
+    std::byte *heap_{nullptr};
+    size_type size_{0};
+    size_type capacity_{N};
+    std::byte inline_[N];
+
+    void append_raw(const void *p, size_type n)
+    {
+      if (n == 0)
+      {
+        return;
+      }
+
+      if (n > capacity_ - size_)
+      {
+        grow_to(size_ + n, p, n);
+      }
+      else
+      {
+        std::memcpy(data() + size_, p, n);
+      }
+      size_ += n;
+    }
+
+    /**
+     * @brief Move the content to a heap block of at least `needed` bytes.
+     *
+     * `tail` is copied after the content before the old storage is freed, so
+     * appending a view of the buffer itself is safe.
+     */
+    void grow_to(size_type needed, const void *tail = nullptr, size_type tail_size = 0)
+    {
+      size_type cap = capacity_ * 2;
+      if (cap < needed)
+      {
+        cap = needed;
+      }
+
+      auto *block = new std::byte[cap];
+      if (size_ != 0)
+      {
+        std::memcpy(block, data(), size_);
+      }
+      if (tail_size != 0)
+      {
+        std::memcpy(block + size_, tail, tail_size);
+      }
+
+      release_heap();
+      heap_ = block;
+      capacity_ = cap;
+    }
+
+    /**
+     * @brief Make room for `n` more bytes without a later reallocation.
+     *
+     * Returns `src`, rebased onto the new storage when it pointed into this
+     * buffer, so a view of the buffer itself can still be appended.
+     */
+    const void *reserve_for_append(size_type n, const void *src)
+    {
+      if (n <= capacity_ - size_)
+      {
+        return src;
+      }
+
+      const auto p = reinterpret_cast<std::uintptr_t>(src);
+      const auto base = reinterpret_cast<std::uintptr_t>(data());
+      const bool owned = p >= base && p < base + size_;
+
+      grow_to(size_ + n);
+      return owned ? static_cast<const void *>(data() + (p - base)) : src;
+    }
+
+    template <std::endian Order, class T>
+    void append_array_endian(std::span<const T> values)
+    {
+      if constexpr (Order == std::endian::native || sizeof(T) == 1)
+      {
+        append(std::as_bytes(values));
+      }
+      else
+      {
+        const auto *src = static_cast<const T *>(reserve_for_append(values.size_bytes(), values.data()));
+        detail::store_endian<Order>(data() + size_, std::span<const T>(src, values.size()));
+        size_ += values.size_bytes();
+      }
+    }
+
+    void release_heap() noexcept
+    {
+      delete[] heap_;
+      heap_ = nullptr;
+      capacity_ = N;
+    }
+
+    void take(InlineBuffer &other) noexcept
+    {
+      size_ = other.size_;
+      if (other.heap_)
+      {
+        heap_ = std::exchange(other.heap_, nullptr);
+        capacity_ = std::exchange(other.capacity_, N);
+      }
+      else if (size_ != 0)
+      {
+        std::memcpy(inline_, other.inline_, size_);
+      }
+      other.size_ = 0;
+    }
+
+    void check_index(size_type i) const
+    {
+      if (i >= size_)
+      {
+        throw std::out_of_range("rix::io::InlineBuffer::at: out of range");
+      }
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_INLINE_BUFFER_HPP
@@ -0,0 +1,276 @@
+/**
+ * @file io_stats.hpp
+ * @brief Opt-in process-wide I/O counters and latency histograms.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ *
+ * Counters are off until `set_io_stats_enabled(true)`; while off, each
+ * instrumented call costs one relaxed atomic load. Define `RIX_IO_NO_STATS`
+ * to compile the instrumentation out entirely.
+ */
+
+#ifndef RIX_IO_IO_STATS_HPP
+#define RIX_IO_IO_STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace rix::io
+{
+  /**
+   * @brief Instrumented operation kinds.
+   *
+   * Every native-backend system call is counted: `read`/`pread`/`readv`
+   * (and `ReadFile`), the write equivalents, syncs and opens. io_uring
+   * reads and writes are counted once per completion, with the latency
+   * measured from submission.
+   */
+  enum class IoOp
+  {
+    read,
+    write,
+    sync,
+    open
+  };
+
+  /**
+   * @brief Number of latency buckets; bucket `i` counts calls that took
+   *        `[2^i, 2^(i+1))` nanoseconds, the last one everything slower.
+   */
+  inline constexpr std::size_t io_latency_buckets = 32;
+
+  /**
+   * @brief Counters of one `IoOp`.
+   */
+  struct IoOpStats
+  {
+    std::uint64_t calls{0};
+    std::uint64_t errors{0};
+    std::uint64_t bytes{0};
+    std::uint64_t total_ns{0};
+    std::array<std::uint64_t, io_latency_buckets> latency_log2_ns{};
+  };
+
+  /**
+   * @brief Snapshot of all counters.
+   */
+  struct IoStatsSnapshot
+  {
+    IoOpStats read{};
+    IoOpStats write{};
+    IoOpStats sync{};
+    IoOpStats open{};
+  };
+
+  using IoStatsCallback = std::function<void(const IoStatsSnapshot &)>;
+
+  namespace detail
+  {
+    struct IoOpCounters
+    {
+      std::atomic<std::uint64_t> calls{0};
+      std::atomic<std::uint64_t> errors{0};
+      std::atomic<std::uint64_t> bytes{0};
+      std::atomic<std::uint64_t> total_ns{0};
+      std::array<std::atomic<std::uint64_t>, io_latency_buckets> latency{};
+    };
+
+    struct IoStatsState
+    {
+      std::atomic<bool> enabled{false};
+      std::array<IoOpCounters, 4> ops{};
+
+      std::mutex callback_mutex;
+      IoStatsCallback callback{};
+    };
+
+    [[nodiscard]] inline IoStatsState &io_stats_state() noexcept
+    {
+      static IoStatsState state;
+      return state;
+    }
+
+    [[nodiscard]] constexpr std::size_t latency_bucket(std::uint64_t ns) noexcept
+    {
+      const auto b = static_cast<std::size_t>(std::bit_width(ns | 1) - 1);
+      return b < io_latency_buckets ? b : io_latency_buckets - 1;
+    }
+
+    inline void record_io(IoOp op, std::uint64_t bytes, bool failed, std::uint64_t ns) noexcept
+    {
+      IoOpCounters &c = io_stats_state().ops[static_cast<std::size_t>(op)];
+      c.calls.fetch_add(1, std::memory_order_relaxed);
+      if (failed)
+      {
+        c.errors.fetch_add(1, std::memory_order_relaxed);
+      }
+      c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+      c.total_ns.fetch_add(ns, std::memory_order_relaxed);
+      c.latency[latency_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+  } // namespace detail
+
+  /**
+   * @brief Whether counters are being collected.
+   */
+  [[nodiscard]] inline bool io_stats_enabled() noexcept
+  {
+#if defined(RIX_IO_NO_STATS)
+    return false;
+#else
+    return detail::io_stats_state().enabled.load(std::memory_order_relaxed);
+#endif
+  }
+
+  /**
+   * @brief Start or stop collecting counters. Has no effect with `RIX_IO_NO_STATS`.
+   */
+  inline void set_io_stats_enabled(bool enabled) noexcept
+  {
+    detail::io_stats_state().enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Current counters. Each value is read atomically, the set as a whole is not.
+   */
+  [[nodiscard]] inline IoStatsSnapshot io_stats_snapshot() noexcept
+  {
+    auto &state = detail::io_stats_state();
+    auto load = [](const detail::IoOpCounters &c)
+    {
+      IoOpStats s;
+      s.calls = c.calls.load(std::memory_order_relaxed);
+      s.errors = c.errors.load(std::memory_order_relaxed);
+      s.bytes = c.bytes.load(std::memory_order_relaxed);
+      s.total_ns = c.total_ns.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < io_latency_buckets; ++i)
+      {
+        s.latency_log2_ns[i] = c.latency[i].load(std::memory_order_relaxed);
+      }
+      return s;
+    };
+
+    IoStatsSnapshot out;
+    out.read = load(state.ops[static_cast<std::size_t>(IoOp::read)]);
+    out.write = load(state.ops[static_cast<std::size_t>(IoOp::write)]);
+    out.sync = load(state.ops[static_cast<std::size_t>(IoOp::sync)]);
+    out.open = load(state.ops[static_cast<std::size_t>(IoOp::open)]);
+    return out;
+  }
+
+  /**
+   * @brief Zero every counter.
+   */
+  inline void reset_io_stats() noexcept
+  {
+    for (auto &c : detail::io_stats_state().ops)
+    {
+      c.calls.store(0, std::memory_order_relaxed);
+      c.errors.store(0, std::memory_order_relaxed);
+      c.bytes.store(0, std::memory_order_relaxed);
+      c.total_ns.store(0, std::memory_order_relaxed);
+      for (auto &b : c.latency)
+      {
+        b.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Install the exporter called by `publish_io_stats()` (empty to remove).
+   */
+  inline void set_io_stats_callback(IoStatsCallback callback)
+  {
+    auto &state = detail::io_stats_state();
+    std::lock_guard<std::mutex> lock(state.callback_mutex);
+    state.callback = std::move(callback);
+  }
+
+  /**
+   * @brief Pass a snapshot to the installed callback, e.g. from a metrics timer.
+   *
+   * @return false if no callback is installed.
+   */
+  inline bool publish_io_stats()
+  {
+    auto &state = detail::io_stats_state();
+    IoStatsCallback callback;
+    {
+      std::lock_guard<std::mutex> lock(state.callback_mutex);
+      callback = state.callback;
+    }
+    if (!callback)
+    {
+      return false;
+    }
+    callback(io_stats_snapshot());
+    return true;
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief Times one instrumented call and records it on destruction.
+     *
+     * Inactive (and free apart from one load) while stats are disabled.
+     */
+    class IoProbe
+    {
+    public:
+      explicit IoProbe(IoOp op) noexcept
+          : op_(op),
+            active_(io_stats_enabled())
+      {
+        if (active_)
+        {
+          start_ = std::chrono::steady_clock::now();
+        }
+      }
+
+      IoProbe(const IoProbe &) = delete;
+      IoProbe &operator=(const IoProbe &) = delete;
+
+      ~IoProbe() noexcept
+      {
+        if (active_)
+        {
+          const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start_)
+                              .count();
+          record_io(op_, bytes_, failed_, static_cast<std::uint64_t>(ns < 0 ? 0 : ns));
+        }
+      }
+
+      /**
+       * @brief Record `n` transferred bytes and return `n`.
+       */
+      std::size_t done(std::size_t n) noexcept
+      {
+        bytes_ = n;
+        return n;
+      }
+
+      void fail() noexcept { failed_ = true; }
+
+    private:
+      IoOp op_;
+      bool active_;
+      bool failed_{false};
+      std::uint64_t bytes_{0};
+      std::chrono::steady_clock::time_point start_{};
+    };
+  } // namespace detail
+
+} // namespace rix::io
+
+#endif // RIX_IO_IO_STATS_HPP
@@ -0,0 +1,214 @@
+/**
+ * @file line_reader.hpp
+ * @brief Buffered line reader handing out zero-copy string views.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_LINE_READER_HPP
+#define RIX_IO_LINE_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <rix/io/buffer.hpp>
+#include <rix/io/file.hpp>
+
+namespace rix::io
+{
+  /**
+   * @brief Options for `LineReader`.
+   */
+  struct LineReaderOptions
+  {
+    /**
+     * @brief Initial size of the internal buffer in bytes. Must be non-zero.
+     *
+     * The buffer grows only when a single line does not fit.
+     */
+    std::size_t buffer_size{64 * 1024};
+
+    /**
+     * @brief Remove a trailing `'\r'` so CRLF files yield the same lines as LF files.
+     */
+    bool strip_cr{true};
+  };
+
+  /**
+   * @brief Read a file line by line without materialising a string per line.
+   *
+   * Lines are returned as `std::string_view` pointing into an internal buffer
+   * that is refilled as needed; a view stays valid until the next call to `next()`.
+   * Lines split across two refills are stitched in place by moving the partial
+   * tail to the front of the buffer. Newlines are located with `std::memchr`,
+   * which the common C libraries implement with vector instructions.
+   *
+   * The line terminator is not part of the returned view. A final line without
+   * a terminator is still returned.
+   *
+   * @code
+   * rix::io::LineReader reader{"app.log"};
+   * std::string_view line;
+   * while (reader.next(line))
+   * {
+   *   consume(line);
+   * }
+   * @endcode
+   */
+  class LineReader
+  {
+  public:
+    /**
+     * @brief Open `path` for line reading.
+     *
+     * @throws std::system_error if opening fails.
+     * @throws std::invalid_argument if `options.buffer_size` is zero.
+     */
+    explicit LineReader(const std::filesystem::path &path, LineReaderOptions options = {})
+        : LineReader(File{path, FileMode::read, FileType::binary, FileBackend::native}, options)
+    {
+    }
+
+    /**
+     * @brief Take ownership of an open, readable, native file.
+     *
+     * Reading starts at offset 0.
+     *
+     * @throws std::invalid_argument if the file is unsuitable or `options.buffer_size` is zero.
+     */
+    explicit LineReader(File &&file, LineReaderOptions options = {})
+        : file_(std::move(file)), buffer_(options.buffer_size), strip_cr_(options.strip_cr)
+    {
+      if (options.buffer_size == 0)
+      {
+        throw std::invalid_argument("rix::io::LineReader: buffer_size must be non-zero");
+      }
+
+      if (!file_.is_open() || file_.backend() != FileBackend::native || !detail::mode_can_read(file_.mode()))
+      {
+        throw std::invalid_argument("rix::io::LineReader: requires an open readable native file");
+      }
+    }
+
+    /**
+     * @brief Read the next line into `line`.
+     *
+     * @return false at end of file (and `line` is left empty).
+     * @throws std::runtime_error if reading fails.
+     */
+    [[nodiscard]] bool next(std::string_view &line)
+    {
+      for (;;)
+      {
+        const char *base = chars();
+        const void *nl = (scan_ < end_) ? std::memchr(base + scan_, '\n', end_ - scan_) : nullptr;
+
+        if (nl != nullptr)
+        {
+          const auto pos = static_cast<std::size_t>(static_cast<const char *>(nl) - base);
+          line = make_line(begin_, pos);
+          begin_ = pos + 1;
+          scan_ = begin_;
+          ++line_number_;
+          return true;
+        }
+
+        scan_ = end_;
+
+        if (eof_)
+        {
+          if (begin_ < end_)
+          {
+            line = make_line(begin_, end_);
+            begin_ = end_;
+            ++line_number_;
+            return true;
+          }
+
+          line = {};
+          return false;
+        }
+
+        refill();
+      }
+    }
+
+    /**
+     * @brief Number of lines returned so far.
+     */
+    [[nodiscard]] std::uint64_t line_number() const noexcept { return line_number_; }
+
+    [[nodiscard]] const File &file() const noexcept { return file_; }
+
+  private:
+    File file_;
+    Buffer buffer_;
+    std::uint64_t offset_{0};
+    std::uint64_t line_number_{0};
+    std::size_t begin_{0};
+    std::size_t scan_{0};
+    std::size_t end_{0};
+    bool strip_cr_{true};
+    bool eof_{false};
+
+    [[nodiscard]] const char *chars() const noexcept
+    {
+      return reinterpret_cast<const char *>(buffer_.data());
+    }
+
+    [[nodiscard]] std::string_view make_line(std::size_t first, std::size_t last) const noexcept
+    {
+      if (strip_cr_ && last > first && chars()[last - 1] == '\r')
+      {
+        --last;
+      }
+      return std::string_view(chars() + first, last - first);
+    }
+
+    /**
+     * @brief Keep the unconsumed tail, then read more bytes after it.
+     */
+    void refill()
+    {
+      if (begin_ != 0)
+      {
+        const std::size_t tail = end_ - begin_;
+        if (tail != 0)
+        {
+          std::memmove(buffer_.data(), buffer_.data() + begin_, tail);
+        }
+        end_ = tail;
+        scan_ -= begin_;
+        begin_ = 0;
+      }
+
+      if (end_ == buffer_.size())
+      {
+        // A single line is larger than the buffer.
+        buffer_.resize(buffer_.size() * 2);
+      }
+
+      const auto room = std::span<std::byte>(buffer_.data() + end_, buffer_.size() - end_);
+      const std::size_t got = file_.read_at(offset_, room);
+      offset_ += got;
+      end_ += got;
+
+      if (got < room.size())
+      {
+        eof_ = true;
+      }
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_LINE_READER_HPP
@@ -0,0 +1,418 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory-mapped file view.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_MAPPED_FILE_HPP
+#define RIX_IO_MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <rix/io/access_pattern.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief RAII read-only memory mapping of an entire file.
+   *
+   * The file content is exposed as a `std::span<const std::byte>` without copying.
+   * Pages are loaded on demand by the operating system.
+   *
+   * - POSIX: `mmap(PROT_READ, MAP_PRIVATE)`
+   * - Windows: `CreateFileMapping` + `MapViewOfFile`
+   *
+   * An empty file maps to an open handle with an empty span.
+   *
+   * Error reporting:
+   * - Open/map errors: `std::system_error` with the OS error code
+   */
+  class MappedFile
+  {
+  public:
+    /**
+     * @brief Construct a closed mapping.
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Map the file at `path` read-only.
+     *
+     * @throws std::system_error if opening or mapping fails.
+     */
+    explicit MappedFile(const std::filesystem::path &path)
+        : path_(path)
+    {
+      open_internal();
+    }
+
+    /**
+     * @brief Unmap the file if mapped.
+     *
+     * Never throws.
+     */
+    ~MappedFile() noexcept { close(); }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Move-construct.
+     */
+    MappedFile(MappedFile &&other) noexcept
+        : path_(std::move(other.path_)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          open_(std::exchange(other.open_, false))
+    {
+      other.path_.clear();
+    }
+
+    /**
+     * @brief Move-assign.
+     */
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+      if (this != &other)
+      {
+        close();
+        path_ = std::move(other.path_);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        open_ = std::exchange(other.open_, false);
+        other.path_.clear();
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Whether a file is currently mapped.
+     */
+    [[nodiscard]] bool is_open() const noexcept { return open_; }
+
+    /**
+     * @brief Convenience boolean conversion (same as `is_open()`).
+     */
+    explicit operator bool() const noexcept { return is_open(); }
+
+    /**
+     * @brief Path associated with this mapping.
+     */
+    [[nodiscard]] const std::filesystem::path &path() const noexcept { return path_; }
+
+    /**
+     * @brief Mapped size in bytes.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Pointer to the first mapped byte, or nullptr if empty.
+     */
+    [[nodiscard]] const std::byte *data() const noexcept { return data_; }
+
+    /**
+     * @brief Zero-copy view of the mapped bytes.
+     */
+    [[nodiscard]] std::span<const std::byte> span() const noexcept
+    {
+      return std::span<const std::byte>(data_, size_);
+    }
+
+    /**
+     * @brief Zero-copy view as string bytes.
+     *
+     * Safe only if the underlying payload represents text.
+     */
+    [[nodiscard]] std::string_view as_string_view() const noexcept
+    {
+      return std::string_view(reinterpret_cast<const char *>(data_), size_);
+    }
+
+    /**
+     * @brief Tell the OS how `[offset, offset + len)` of the mapping will be accessed.
+     *
+     * `len == 0` (or a range past the end) extends to the end of the mapping;
+     * the range is widened to page boundaries. Maps to `madvise` on POSIX and
+     * `PrefetchVirtualMemory` (`will_need` only) on Windows 8+. Best-effort.
+     *
+     * @return false if the hint is unsupported or was rejected; true for an empty mapping.
+     * @throws std::invalid_argument if `offset > size()`.
+     */
+    bool advise(AccessPattern pattern, std::size_t offset = 0, std::size_t len = 0) const
+    {
+      void *addr = nullptr;
+      std::size_t bytes = 0;
+      if (!page_range(offset, len, addr, bytes))
+      {
+        return true;
+      }
+
+#if defined(_WIN32)
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+      if (pattern == AccessPattern::will_need)
+      {
+        WIN32_MEMORY_RANGE_ENTRY range{addr, bytes};
+        return ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0) != 0;
+      }
+#endif
+      (void)pattern;
+      return false;
+#else
+      int advice = 0;
+      switch (pattern)
+      {
+      case AccessPattern::normal:
+        advice = MADV_NORMAL;
+        break;
+      case AccessPattern::sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+      case AccessPattern::random:
+        advice = MADV_RANDOM;
+        break;
+      case AccessPattern::will_need:
+        advice = MADV_WILLNEED;
+        break;
+      case AccessPattern::dont_need:
+        // Read-only private mapping: dropped pages are re-read from the file.
+        advice = MADV_DONTNEED;
+        break;
+#if defined(MADV_COLD)
+      case AccessPattern::no_reuse:
+        advice = MADV_COLD;
+        break;
+#endif
+#if defined(MADV_HUGEPAGE)
+      case AccessPattern::huge_pages:
+        advice = MADV_HUGEPAGE;
+        break;
+#endif
+      default:
+        return false;
+      }
+      return ::madvise(addr, bytes, advice) == 0;
+#endif
+    }
+
+    /**
+     * @brief Start faulting in `[offset, offset + len)` without waiting (`len == 0`: to end).
+     *
+     * Same as `advise(AccessPattern::will_need, offset, len)`.
+     */
+    bool prefetch(std::size_t offset = 0, std::size_t len = 0) const
+    {
+      return advise(AccessPattern::will_need, offset, len);
+    }
+
+    /**
+     * @brief Unmap the file if mapped.
+     *
+     * Never throws.
+     */
+    void close() noexcept
+    {
+      if (data_ != nullptr)
+      {
+#if defined(_WIN32)
+        ::UnmapViewOfFile(data_);
+#else
+        ::munmap(const_cast<std::byte *>(data_), size_);
+#endif
+      }
+
+      data_ = nullptr;
+      size_ = 0;
+      open_ = false;
+    }
+
+  private:
+    std::filesystem::path path_{};
+    const std::byte *data_{nullptr};
+    std::size_t size_{0};
+    bool open_{false};
+
+    /**
+     * @brief Page-aligned span covering `[offset, offset + len)`, clamped to the mapping.
+     *
+     * @return false if the range is empty.
+     */
+    bool page_range(std::size_t offset, std::size_t len, void *&addr, std::size_t &bytes) const
+    {
+      if (offset > size_)
+      {
+        throw std::invalid_argument("rix::io::MappedFile::advise: out of range");
+      }
+
+      const std::size_t end = (len == 0 || len > size_ - offset) ? size_ : offset + len;
+      if (data_ == nullptr || offset == end)
+      {
+        return false;
+      }
+
+      // Mappings start on a page boundary, so aligning offsets aligns addresses.
+      const std::size_t page = page_size();
+      const std::size_t begin = offset - offset % page;
+      addr = const_cast<std::byte *>(data_ + begin);
+      bytes = end - begin;
+      return true;
+    }
+
+    static std::size_t page_size() noexcept
+    {
+#if defined(_WIN32)
+      SYSTEM_INFO info{};
+      ::GetSystemInfo(&info);
+      return static_cast<std::size_t>(info.dwPageSize);
+#else
+      const long page = ::sysconf(_SC_PAGESIZE);
+      return page > 0 ? static_cast<std::size_t>(page) : 4096;
+#endif
+    }
+
+#if defined(_WIN32)
+    void open_internal()
+    {
+      HANDLE file = ::CreateFileW(path_.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+      {
+        throw_last_error("open failed");
+      }
+
+      LARGE_INTEGER size{};
+      if (!::GetFileSizeEx(file, &size))
+      {
+        const DWORD err = ::GetLastError();
+        ::CloseHandle(file);
+        throw_error(err, "size failed");
+      }
+
+      if (size.QuadPart == 0)
+      {
+        ::CloseHandle(file);
+        open_ = true;
+        return;
+      }
+
+      HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping == nullptr)
+      {
+        const DWORD err = ::GetLastError();
+        ::CloseHandle(file);
+        throw_error(err, "map failed");
+      }
+
+      void *view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      const DWORD err = ::GetLastError();
+
+      // The view keeps the mapping object alive.
+      ::CloseHandle(mapping);
+      ::CloseHandle(file);
+
+      if (view == nullptr)
+      {
+        throw_error(err, "map failed");
+      }
+
+      data_ = static_cast<const std::byte *>(view);
+      size_ = static_cast<std::size_t>(size.QuadPart);
+      open_ = true;
+    }
+
+    [[noreturn]] void throw_last_error(const char *what) const
+    {
+      throw_error(::GetLastError(), what);
+    }
+
+    [[noreturn]] void throw_error(DWORD err, const char *what) const
+    {
+      throw std::system_error(static_cast<int>(err), std::system_category(),
+                              std::string("rix::io::MappedFile: ") + what + ": " + path_.string());
+    }
+#else
+    void open_internal()
+    {
+      const int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0)
+      {
+        throw_errno(errno, "open failed");
+      }
+
+      struct ::stat st{};
+      if (::fstat(fd, &st) != 0)
+      {
+        const int err = errno;
+        ::close(fd);
+        throw_errno(err, "stat failed");
+      }
+
+      const auto size = static_cast<std::size_t>(st.st_size);
+      if (size == 0)
+      {
+        ::close(fd);
+        open_ = true;
+        return;
+      }
+
+      void *p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      const int err = errno;
+
+      // The mapping stays valid after the descriptor is closed.
+      ::close(fd);
+
+      if (p == MAP_FAILED)
+      {
+        throw_errno(err, "map failed");
+      }
+
+      data_ = static_cast<const std::byte *>(p);
+      size_ = size;
+      open_ = true;
+    }
+
+    [[noreturn]] void throw_errno(int err, const char *what) const
+    {
+      throw std::system_error(err, std::generic_category(),
+                              std::string("rix::io::MappedFile: ") + what + ": " + path_.string());
+    }
+#endif
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_MAPPED_FILE_HPP
@@ -0,0 +1,1054 @@
+/**
+ * @file native_handle.hpp
+ * @brief Thin RAII wrapper over OS file descriptors / handles.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_NATIVE_HANDLE_HPP
+#define RIX_IO_NATIVE_HANDLE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include <rix/io/access_pattern.hpp>
+#include <rix/io/io_stats.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <winioctl.h>
+#else
+#include <climits>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/falloc.h>
+#endif
+#endif
+
+namespace rix::io::detail
+{
+#if defined(_WIN32)
+  using native_handle_type = HANDLE;
+#else
+  using native_handle_type = int;
+#endif
+
+  /**
+   * @brief Access flags used to open a native handle.
+   */
+  struct NativeOpenOptions
+  {
+    bool read{false};
+    bool write{false};
+    bool create{false};
+    bool truncate{false};
+    bool append{false};
+
+    /**
+     * @brief Bypass the OS page cache (`O_DIRECT`, `F_NOCACHE`, `FILE_FLAG_NO_BUFFERING`).
+     */
+    bool direct{false};
+
+    /**
+     * @brief Create the file and fail with `file_exists` if it is already there (`O_EXCL`, `CREATE_NEW`).
+     */
+    bool exclusive{false};
+  };
+
+  /**
+   * @brief Last OS error as a `std::error_code`.
+   */
+  [[nodiscard]] inline std::error_code last_os_error() noexcept
+  {
+#if defined(_WIN32)
+    return std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+#else
+    return std::error_code(errno, std::generic_category());
+#endif
+  }
+
+  /**
+   * @brief Flush data written through `h` to stable storage.
+   *
+   * With `data_only`, metadata not needed to read the data back (e.g. mtime)
+   * may be skipped (`fdatasync` on Linux). On macOS `F_FULLFSYNC` is used
+   * so the drive cache is flushed too.
+   */
+  inline void sync_native(native_handle_type h, bool data_only, std::error_code &ec) noexcept
+  {
+    ec.clear();
+    IoProbe probe{IoOp::sync};
+#if defined(_WIN32)
+    (void)data_only;
+    if (!::FlushFileBuffers(h))
+    {
+      probe.fail();
+      ec = last_os_error();
+    }
+#else
+#if defined(__APPLE__)
+    (void)data_only;
+    if (::fcntl(h, F_FULLFSYNC) == 0)
+    {
+      return;
+    }
+#endif
+    int r = 0;
+    do
+    {
+#if defined(__linux__)
+      r = data_only ? ::fdatasync(h) : ::fsync(h);
+#else
+      (void)data_only;
+      r = ::fsync(h);
+#endif
+    } while (r != 0 && errno == EINTR);
+
+    if (r != 0)
+    {
+      probe.fail();
+      ec = last_os_error();
+    }
+#endif
+  }
+
+#if defined(_WIN32)
+  /**
+   * @brief Restores the file pointer of a synchronous handle on destruction.
+   *
+   * `ReadFile` / `WriteFile` with an `OVERLAPPED` offset still move the file
+   * pointer of a handle opened without `FILE_FLAG_OVERLAPPED`, unlike
+   * `pread` / `pwrite`.
+   */
+  class FilePointerGuard
+  {
+  public:
+    explicit FilePointerGuard(HANDLE h) noexcept
+        : handle_(h)
+    {
+      LARGE_INTEGER zero{};
+      saved_ = ::SetFilePointerEx(handle_, zero, &position_, FILE_CURRENT) != 0;
+    }
+
+    FilePointerGuard(const FilePointerGuard &) = delete;
+    FilePointerGuard &operator=(const FilePointerGuard &) = delete;
+
+    ~FilePointerGuard() noexcept
+    {
+      if (saved_)
+      {
+        const DWORD err = ::GetLastError();
+        (void)::SetFilePointerEx(handle_, position_, nullptr, FILE_BEGIN);
+        ::SetLastError(err);
+      }
+    }
+
+  private:
+    HANDLE handle_;
+    LARGE_INTEGER position_{};
+    bool saved_{false};
+  };
+#endif
+
+  /**
+   * @brief RAII owner of an OS file descriptor (POSIX) or HANDLE (Windows).
+   *
+   * All operations are `noexcept` and report failures through `std::error_code`.
+   * Interrupted system calls (`EINTR`) are retried transparently.
+   * No userspace buffering and no newline translation is performed.
+   */
+  class NativeHandle
+  {
+  public:
+    NativeHandle() = default;
+
+    ~NativeHandle() noexcept { close(); }
+
+    NativeHandle(const NativeHandle &) = delete;
+    NativeHandle &operator=(const NativeHandle &) = delete;
+
+    NativeHandle(NativeHandle &&other) noexcept
+        : h_(std::exchange(other.h_, invalid()))
+    {
+    }
+
+    NativeHandle &operator=(NativeHandle &&other) noexcept
+    {
+      if (this != &other)
+      {
+        close();
+        h_ = std::exchange(other.h_, invalid());
+      }
+      return *this;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return h_ != invalid(); }
+
+    /**
+     * @brief Underlying descriptor / HANDLE (not released).
+     */
+    [[nodiscard]] native_handle_type get() const noexcept { return h_; }
+
+    /**
+     * @brief Open `path` with `opts`, closing any previously held handle.
+     */
+    void open(const std::filesystem::path &path, const NativeOpenOptions &opts, std::error_code &ec) noexcept
+    {
+      IoProbe probe{IoOp::open};
+      open_internal(path, opts, ec);
+      if (ec)
+      {
+        probe.fail();
+      }
+    }
+
+    /**
+     * @brief Close the handle if open.
+     *
+     * Never throws.
+     */
+    void close() noexcept
+    {
+      if (!is_open())
+      {
+        return;
+      }
+
+#if defined(_WIN32)
+      ::CloseHandle(h_);
+#else
+      ::close(h_);
+#endif
+      h_ = invalid();
+    }
+
+    /**
+     * @brief Read up to `n` bytes at the current position.
+     *
+     * @return Number of bytes read; 0 at end of file or on error.
+     */
+    [[nodiscard]] std::size_t read_some(std::byte *p, std::size_t n, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      IoProbe probe{IoOp::read};
+#if defined(_WIN32)
+      DWORD got = 0;
+      if (!::ReadFile(h_, p, clamp_io(n), &got, nullptr))
+      {
+        probe.fail();
+        ec = last_os_error();
+        return 0;
+      }
+      return probe.done(static_cast<std::size_t>(got));
+#else
+      for (;;)
+      {
+        const ::ssize_t r = ::read(h_, p, n);
+        if (r >= 0)
+        {
+          return probe.done(static_cast<std::size_t>(r));
+        }
+        if (errno != EINTR)
+        {
+          probe.fail();
+          ec = last_os_error();
+          return 0;
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Write up to `n` bytes at the current position.
+     *
+     * @return Number of bytes written; 0 on error.
+     */
+    [[nodiscard]] std::size_t write_some(const std::byte *p, std::size_t n, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      IoProbe probe{IoOp::write};
+#if defined(_WIN32)
+      DWORD put = 0;
+      if (!::WriteFile(h_, p, clamp_io(n), &put, nullptr))
+      {
+        probe.fail();
+        ec = last_os_error();
+        return 0;
+      }
+      return probe.done(static_cast<std::size_t>(put));
+#else
+      for (;;)
+      {
+        const ::ssize_t r = ::write(h_, p, n);
+        if (r >= 0)
+        {
+          return probe.done(static_cast<std::size_t>(r));
+        }
+        if (errno != EINTR)
+        {
+          probe.fail();
+          ec = last_os_error();
+          return 0;
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Read up to `n` bytes at absolute `offset` (pread semantics).
+     *
+     * On Windows the file pointer is saved and restored around the call, so it
+     * is left unchanged unless another thread moves it or issues positional
+     * I/O on the same handle concurrently.
+     *
+     * @return Number of bytes read; 0 at end of file or on error.
+     */
+    [[nodiscard]] std::size_t read_some_at(std::byte *p, std::size_t n, std::uint64_t offset, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      IoProbe probe{IoOp::read};
+#if defined(_WIN32)
+      const FilePointerGuard keep_position{h_};
+      OVERLAPPED ov{};
+      ov.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+      ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+      DWORD got = 0;
+      if (!::ReadFile(h_, p, clamp_io(n), &got, &ov))
+      {
+        if (::GetLastError() == ERROR_HANDLE_EOF)
+        {
+          return 0;
+        }
+        probe.fail();
+        ec = last_os_error();
+        return 0;
+      }
+      return probe.done(static_cast<std::size_t>(got));
+#else
+      for (;;)
+      {
+        const ::ssize_t r = ::pread(h_, p, n, static_cast<::off_t>(offset));
+        if (r >= 0)
+        {
+          return probe.done(static_cast<std::size_t>(r));
+        }
+        if (errno != EINTR)
+        {
+          probe.fail();
+          ec = last_os_error();
+          return 0;
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Write up to `n` bytes at absolute `offset` (pwrite semantics).
+     *
+     * The file pointer is restored on Windows as in `read_some_at()`.
+     *
+     * @return Number of bytes written; 0 on error.
+     */
+    [[nodiscard]] std::size_t write_some_at(const std::byte *p, std::size_t n, std::uint64_t offset, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      IoProbe probe{IoOp::write};
+#if defined(_WIN32)
+      const FilePointerGuard keep_position{h_};
+      OVERLAPPED ov{};
+      ov.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+      ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+      DWORD put = 0;
+      if (!::WriteFile(h_, p, clamp_io(n), &put, &ov))
+      {
+        probe.fail();
+        ec = last_os_error();
+        return 0;
+      }
+      return probe.done(static_cast<std::size_t>(put));
+#else
+      for (;;)
+      {
+        const ::ssize_t r = ::pwrite(h_, p, n, static_cast<::off_t>(offset));
+        if (r >= 0)
+        {
+          return probe.done(static_cast<std::size_t>(r));
+        }
+        if (errno != EINTR)
+        {
+          probe.fail();
+          ec = last_os_error();
+          return 0;
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Move the current position to absolute `offset`.
+     */
+    void seek(std::uint64_t offset, std::error_code &ec) noexcept
+    {
+      ec.clear();
+#if defined(_WIN32)
+      LARGE_INTEGER li{};
+      li.QuadPart = static_cast<LONGLONG>(offset);
+      if (!::SetFilePointerEx(h_, li, nullptr, FILE_BEGIN))
+      {
+        ec = last_os_error();
+      }
+#else
+      if (::lseek(h_, static_cast<::off_t>(offset), SEEK_SET) < 0)
+      {
+        ec = last_os_error();
+      }
+#endif
+    }
+
+    /**
+     * @brief Current file size in bytes.
+     */
+    [[nodiscard]] std::uint64_t size(std::error_code &ec) const noexcept
+    {
+      ec.clear();
+#if defined(_WIN32)
+      LARGE_INTEGER li{};
+      if (!::GetFileSizeEx(h_, &li))
+      {
+        ec = last_os_error();
+        return 0;
+      }
+      return static_cast<std::uint64_t>(li.QuadPart);
+#else
+      struct ::stat st{};
+      if (::fstat(h_, &st) != 0)
+      {
+        ec = last_os_error();
+        return 0;
+      }
+      return static_cast<std::uint64_t>(st.st_size);
+#endif
+    }
+
+    /**
+     * @brief Flush written data to stable storage (see `sync_native()`).
+     */
+    void sync(bool data_only, std::error_code &ec) noexcept { sync_native(h_, data_only, ec); }
+
+    /**
+     * @brief Reserve disk space for the first `size` bytes without changing the file size.
+     *
+     * @return false (with `ec` clear) if the platform or filesystem cannot preallocate.
+     */
+    bool preallocate(std::uint64_t size, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      if (size == 0)
+      {
+        return true;
+      }
+
+#if defined(_WIN32)
+      // A smaller allocation size would truncate the file.
+      LARGE_INTEGER current{};
+      if (::GetFileSizeEx(h_, &current) && static_cast<std::uint64_t>(current.QuadPart) >= size)
+      {
+        return true;
+      }
+
+      FILE_ALLOCATION_INFO info{};
+      info.AllocationSize.QuadPart = static_cast<LONGLONG>(size);
+      if (!::SetFileInformationByHandle(h_, FileAllocationInfo, &info, sizeof(info)))
+      {
+        ec = last_os_error();
+        return false;
+      }
+      return true;
+#elif defined(__linux__)
+      int r = 0;
+      do
+      {
+        r = ::fallocate(h_, FALLOC_FL_KEEP_SIZE, 0, static_cast<::off_t>(size));
+      } while (r != 0 && errno == EINTR);
+      return finish_space_op(r, ec);
+#elif defined(__APPLE__)
+      std::uint64_t current = 0;
+      struct ::stat st{};
+      if (::fstat(h_, &st) == 0)
+      {
+        current = static_cast<std::uint64_t>(st.st_size);
+      }
+      if (size <= current)
+      {
+        return true;
+      }
+
+      // F_PEOFPOSMODE allocates from the physical end of file; try contiguous first.
+      ::fstore_t store{F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<::off_t>(size - current), 0};
+      int r = ::fcntl(h_, F_PREALLOCATE, &store);
+      if (r != 0)
+      {
+        store.fst_flags = F_ALLOCATEALL;
+        r = ::fcntl(h_, F_PREALLOCATE, &store);
+      }
+      return finish_space_op(r, ec);
+#else
+      (void)size;
+      return false;
+#endif
+    }
+
+    /**
+     * @brief Deallocate `[offset, offset + len)` so it reads back as zeros, keeping the file size.
+     *
+     * @return false (with `ec` clear) if the platform or filesystem cannot punch holes;
+     *         the range is then left unchanged.
+     */
+    bool punch_hole(std::uint64_t offset, std::uint64_t len, std::error_code &ec) noexcept
+    {
+      ec.clear();
+      if (len == 0)
+      {
+        return true;
+      }
+
+#if defined(_WIN32)
+      DWORD returned = 0;
+      FILE_SET_SPARSE_BUFFER sparse{};
+      sparse.SetSparse = TRUE;
+      if (!::DeviceIoControl(h_, FSCTL_SET_SPARSE, &sparse, sizeof(sparse), nullptr, 0, &returned, nullptr))
+      {
+        ec = last_os_error();
+        return false;
+      }
+
+      FILE_ZERO_DATA_INFORMATION zero{};
+      zero.FileOffset.QuadPart = static_cast<LONGLONG>(offset);
+      zero.BeyondFinalZero.QuadPart = static_cast<LONGLONG>(offset + len);
+      if (!::DeviceIoControl(h_, FSCTL_SET_ZERO_DATA, &zero, sizeof(zero), nullptr, 0, &returned, nullptr))
+      {
+        ec = last_os_error();
+        return false;
+      }
+      return true;
+#elif defined(__linux__)
+      int r = 0;
+      do
+      {
+        r = ::fallocate(h_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                        static_cast<::off_t>(offset), static_cast<::off_t>(len));
+      } while (r != 0 && errno == EINTR);
+      return finish_space_op(r, ec);
+#elif defined(__APPLE__) && defined(F_PUNCHHOLE)
+      ::fpunchhole_t hole{0, 0, static_cast<::off_t>(offset), static_cast<::off_t>(len)};
+      return finish_space_op(::fcntl(h_, F_PUNCHHOLE, &hole), ec);
+#else
+      (void)offset;
+      (void)len;
+      return false;
+#endif
+    }
+
+    /**
+     * @brief Pass an access-pattern hint for `[offset, offset + len)` (`len == 0`: to end of file).
+     *
+     * @return false if the hint is unsupported here or was rejected.
+     */
+    bool advise(AccessPattern pattern, std::uint64_t offset, std::uint64_t len) noexcept
+    {
+#if defined(__APPLE__)
+      switch (pattern)
+      {
+      case AccessPattern::sequential:
+      case AccessPattern::normal:
+        return ::fcntl(h_, F_RDAHEAD, 1) != -1;
+      case AccessPattern::random:
+        return ::fcntl(h_, F_RDAHEAD, 0) != -1;
+      case AccessPattern::will_need:
+        return prefetch(offset, len);
+      default:
+        return false;
+      }
+#elif defined(POSIX_FADV_NORMAL)
+      int advice = 0;
+      switch (pattern)
+      {
+      case AccessPattern::normal:
+        advice = POSIX_FADV_NORMAL;
+        break;
+      case AccessPattern::sequential:
+        advice = POSIX_FADV_SEQUENTIAL;
+        break;
+      case AccessPattern::random:
+        advice = POSIX_FADV_RANDOM;
+        break;
+      case AccessPattern::will_need:
+        advice = POSIX_FADV_WILLNEED;
+        break;
+      case AccessPattern::dont_need:
+        advice = POSIX_FADV_DONTNEED;
+        break;
+      case AccessPattern::no_reuse:
+        advice = POSIX_FADV_NOREUSE;
+        break;
+      default:
+        return false;
+      }
+      return ::posix_fadvise(h_, static_cast<::off_t>(offset), static_cast<::off_t>(len), advice) == 0;
+#else
+      (void)pattern;
+      (void)offset;
+      (void)len;
+      return false;
+#endif
+    }
+
+    /**
+     * @brief Start reading `[offset, offset + len)` into the page cache without waiting for it.
+     *
+     * @return false if prefetching is unsupported here or was rejected.
+     */
+    bool prefetch(std::uint64_t offset, std::uint64_t len) noexcept
+    {
+#if defined(__linux__)
+      if (len == 0)
+      {
+        return ::posix_fadvise(h_, static_cast<::off_t>(offset), 0, POSIX_FADV_WILLNEED) == 0;
+      }
+      return ::readahead(h_, static_cast<::off64_t>(offset), static_cast<std::size_t>(len)) == 0;
+#elif defined(__APPLE__)
+      struct ::radvisory ra{};
+      ra.ra_offset = static_cast<::off_t>(offset);
+      ra.ra_count = static_cast<int>(std::min<std::uint64_t>(len == 0 ? (std::uint64_t{1} << 30) : len, INT_MAX));
+      return ::fcntl(h_, F_RDADVISE, &ra) != -1;
+#elif defined(POSIX_FADV_WILLNEED)
+      return ::posix_fadvise(h_, static_cast<::off_t>(offset), static_cast<::off_t>(len), POSIX_FADV_WILLNEED) == 0;
+#else
+      (void)offset;
+      (void)len;
+      return false;
+#endif
+    }
+
+  private:
+    void open_internal(const std::filesystem::path &path, const NativeOpenOptions &opts, std::error_code &ec) noexcept
+    {
+      close();
+      ec.clear();
+
+#if defined(_WIN32)
+      DWORD access = 0;
+      if (opts.read)
+      {
+        access |= GENERIC_READ;
+      }
+      if (opts.append)
+      {
+        access |= FILE_APPEND_DATA | FILE_READ_ATTRIBUTES | SYNCHRONIZE;
+      }
+      else if (opts.write)
+      {
+        access |= GENERIC_WRITE;
+      }
+
+      DWORD disposition = OPEN_EXISTING;
+      if (opts.exclusive)
+      {
+        disposition = CREATE_NEW;
+      }
+      else if (opts.create && opts.truncate)
+      {
+        disposition = CREATE_ALWAYS;
+      }
+      else if (opts.create)
+      {
+        disposition = OPEN_ALWAYS;
+      }
+      else if (opts.truncate)
+      {
+        disposition = TRUNCATE_EXISTING;
+      }
+
+      HANDLE h = ::CreateFileW(path.c_str(),
+                               access,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               disposition,
+                               opts.direct ? FILE_FLAG_NO_BUFFERING : FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+      if (h == INVALID_HANDLE_VALUE)
+      {
+        ec = last_os_error();
+        return;
+      }
+      h_ = h;
+#else
+      int flags = O_CLOEXEC;
+      if (opts.read && (opts.write || opts.append))
+      {
+        flags |= O_RDWR;
+      }
+      else if (opts.write || opts.append)
+      {
+        flags |= O_WRONLY;
+      }
+      else
+      {
+        flags |= O_RDONLY;
+      }
+      if (opts.create || opts.exclusive)
+      {
+        flags |= O_CREAT;
+      }
+      if (opts.exclusive)
+      {
+        flags |= O_EXCL;
+      }
+      if (opts.truncate)
+      {
+        flags |= O_TRUNC;
+      }
+      if (opts.append)
+      {
+        flags |= O_APPEND;
+      }
+#if defined(O_DIRECT)
+      if (opts.direct)
+      {
+        flags |= O_DIRECT;
+      }
+#endif
+
+      int fd = -1;
+      do
+      {
+        fd = ::open(path.c_str(), flags, 0666);
+      } while (fd < 0 && errno == EINTR);
+
+      if (fd < 0)
+      {
+        ec = last_os_error();
+        return;
+      }
+      h_ = fd;
+
+#if defined(__APPLE__)
+      if (opts.direct && ::fcntl(fd, F_NOCACHE, 1) != 0)
+      {
+        ec = last_os_error();
+        close();
+        return;
+      }
+#elif !defined(O_DIRECT)
+      if (opts.direct)
+      {
+        ec = std::make_error_code(std::errc::not_supported);
+        close();
+        return;
+      }
+#endif
+#endif
+    }
+
+#if defined(_WIN32)
+    HANDLE h_{INVALID_HANDLE_VALUE};
+
+    [[nodiscard]] static HANDLE invalid() noexcept { return INVALID_HANDLE_VALUE; }
+
+    [[nodiscard]] static DWORD clamp_io(std::size_t n) noexcept
+    {
+      return static_cast<DWORD>(std::min<std::size_t>(n, std::size_t{1} << 30));
+    }
+#else
+    int h_{-1};
+
+    [[nodiscard]] static int invalid() noexcept { return -1; }
+
+    /**
+     * @brief Map a space-management syscall result: unsupported operations are not errors.
+     */
+    static bool finish_space_op(int r, std::error_code &ec) noexcept
+    {
+      if (r == 0)
+      {
+        return true;
+      }
+      if (errno == EOPNOTSUPP || errno == ENOTSUP || errno == ENOSYS)
+      {
+        return false;
+      }
+      ec = last_os_error();
+      return false;
+    }
+#endif
+  };
+
+  /**
+   * @brief Write exactly `n` bytes at the current position.
+   */
+  inline void write_all(NativeHandle &h, const std::byte *p, std::size_t n, std::error_code &ec) noexcept
+  {
+    ec.clear();
+    while (n != 0)
+    {
+      const std::size_t put = h.write_some(p, n, ec);
+      if (ec)
+      {
+        return;
+      }
+      if (put == 0)
+      {
+        ec = std::make_error_code(std::errc::io_error);
+        return;
+      }
+      p += put;
+      n -= put;
+    }
+  }
+
+  /**
+   * @brief Read until `n` bytes are read or end of file is reached.
+   *
+   * @return Number of bytes read.
+   */
+  [[nodiscard]] inline std::size_t read_full(NativeHandle &h, std::byte *p, std::size_t n, std::error_code &ec) noexcept
+  {
+    ec.clear();
+    std::size_t total = 0;
+    while (total < n)
+    {
+      const std::size_t got = h.read_some(p + total, n - total, ec);
+      if (ec || got == 0)
+      {
+        break;
+      }
+      total += got;
+    }
+    return total;
+  }
+
+#if !defined(_WIN32)
+  /**
+   * @brief Maximum number of `iovec` entries passed per `readv`/`writev` call.
+   */
+#if defined(IOV_MAX) && IOV_MAX < 64
+  inline constexpr std::size_t max_iov = IOV_MAX;
+#else
+  inline constexpr std::size_t max_iov = 64;
+#endif
+
+  /**
+   * @brief Fill `iov` from `parts`, starting `skip` bytes into `parts[first]`.
+   *
+   * Empty parts are skipped.
+   *
+   * @return Number of entries filled.
+   */
+  template <class Byte>
+  [[nodiscard]] inline int fill_iov(::iovec *iov, std::span<const std::span<Byte>> parts, std::size_t first, std::size_t skip) noexcept
+  {
+    int n = 0;
+    for (std::size_t i = first; i < parts.size() && static_cast<std::size_t>(n) < max_iov; ++i)
+    {
+      const std::size_t off = (i == first) ? skip : 0;
+      if (parts[i].size() <= off)
+      {
+        continue;
+      }
+      iov[n].iov_base = const_cast<std::byte *>(parts[i].data() + off);
+      iov[n].iov_len = parts[i].size() - off;
+      ++n;
+    }
+    return n;
+  }
+
+  /**
+   * @brief Advance (`first`, `skip`) by `n` bytes across `parts`.
+   */
+  template <class Byte>
+  inline void advance_parts(std::span<const std::span<Byte>> parts, std::size_t &first, std::size_t &skip, std::size_t n) noexcept
+  {
+    while (first < parts.size())
+    {
+      const std::size_t left = parts[first].size() - skip;
+      if (n < left)
+      {
+        skip += n;
+        return;
+      }
+      n -= left;
+      ++first;
+      skip = 0;
+    }
+  }
+#endif
+
+  /**
+   * @brief Gather-write every part, in order, at the current position.
+   *
+   * Maps to `writev` on POSIX (partial writes are resumed). On Windows, where
+   * `WriteFileGather` is limited to unbuffered page-aligned I/O, parts are
+   * written one after the other.
+   */
+  inline void write_all_gather(NativeHandle &h, std::span<const std::span<const std::byte>> parts, std::error_code &ec) noexcept
+  {
+    ec.clear();
+#if defined(_WIN32)
+    for (const auto &part : parts)
+    {
+      write_all(h, part.data(), part.size(), ec);
+      if (ec)
+      {
+        return;
+      }
+    }
+#else
+    std::size_t first = 0;
+    std::size_t skip = 0;
+    ::iovec iov[max_iov];
+
+    for (;;)
+    {
+      const int n = fill_iov(iov, parts, first, skip);
+      if (n == 0)
+      {
+        return;
+      }
+
+      IoProbe probe{IoOp::write};
+      const ::ssize_t r = ::writev(h.get(), iov, n);
+      if (r < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        probe.fail();
+        ec = last_os_error();
+        return;
+      }
+      if (r == 0)
+      {
+        ec = std::make_error_code(std::errc::io_error);
+        return;
+      }
+
+      (void)probe.done(static_cast<std::size_t>(r));
+      advance_parts(parts, first, skip, static_cast<std::size_t>(r));
+    }
+#endif
+  }
+
+  /**
+   * @brief Scatter-read into every part, in order, from the current position.
+   *
+   * Maps to `readv` on POSIX. Stops early at end of file.
+   *
+   * @return Total number of bytes read.
+   */
+  [[nodiscard]] inline std::size_t read_full_scatter(NativeHandle &h, std::span<const std::span<std::byte>> parts, std::error_code &ec) noexcept
+  {
+    ec.clear();
+    std::size_t total = 0;
+#if defined(_WIN32)
+    for (const auto &part : parts)
+    {
+      const std::size_t got = read_full(h, part.data(), part.size(), ec);
+      total += got;
+      if (ec || got < part.size())
+      {
+        break;
+      }
+    }
+#else
+    std::size_t first = 0;
+    std::size_t skip = 0;
+    ::iovec iov[max_iov];
+
+    for (;;)
+    {
+      const int n = fill_iov(iov, parts, first, skip);
+      if (n == 0)
+      {
+        break;
+      }
+
+      IoProbe probe{IoOp::read};
+      const ::ssize_t r = ::readv(h.get(), iov, n);
+      if (r < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        probe.fail();
+        ec = last_os_error();
+        break;
+      }
+      if (r == 0)
+      {
+        break;
+      }
+
+      total += probe.done(static_cast<std::size_t>(r));
+      advance_parts(parts, first, skip, static_cast<std::size_t>(r));
+    }
+#endif
+    return total;
+  }
+
+  /**
+   * @brief Make directory entry changes (create, rename) in `dir` durable.
+   *
+   * No-op on Windows, where directory handles cannot be flushed.
+   */
+  inline void sync_directory(const std::filesystem::path &dir, std::error_code &ec) noexcept
+  {
+    ec.clear();
+#if defined(_WIN32)
+    (void)dir;
+#else
+    int fd = -1;
+    do
+    {
+      fd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd < 0)
+    {
+      ec = last_os_error();
+      return;
+    }
+
+    if (::fsync(fd) != 0 && errno != EINVAL)
+    {
+      ec = last_os_error();
+    }
+    ::close(fd);
+#endif
+  }
+
+} // namespace rix::io::detail
+
+#endif // RIX_IO_NATIVE_HANDLE_HPP
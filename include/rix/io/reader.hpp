@@ -17,7 +17,9 @@
 #include <string>
 #include <vector>
 
+#include <rix/io/buffer.hpp>
 #include <rix/io/file.hpp>
+#include <rix/io/mapped_file.hpp>
 
 namespace rix::io
 {
@@ -40,7 +42,8 @@ namespace rix::io
   /**
    * @brief Read an entire file as bytes.
    *
-   * Opens the file with `FileMode::read` and `FileType::binary`.
+   * Opens the file with `FileMode::read`, `FileType::binary` and `FileBackend::native`
+   * (binary content needs no stream translation).
    *
    * @param path Path to the file.
    * @return File content as raw bytes.
@@ -49,10 +52,44 @@ namespace rix::io
    */
   [[nodiscard]] inline std::vector<std::byte> read_file_binary(const std::filesystem::path &path)
   {
-    File f{path, FileMode::read, FileType::binary};
+    File f{path, FileMode::read, FileType::binary, FileBackend::native};
     return f.read_all_bytes();
   }
 
+  /**
+   * @brief Read an entire file into an existing buffer.
+   *
+   * Opens the file with `FileMode::read`, `FileType::binary` and `FileBackend::native`.
+   * `out` is cleared first and its capacity is reused; it only grows when the
+   * file is larger than any previously read one.
+   *
+   * @param path Path to the file.
+   * @param out Destination buffer.
+   * @throws std::system_error If opening fails.
+   * @throws std::runtime_error If reading fails.
+   */
+  template <class Allocator>
+  void read_file_into(const std::filesystem::path &path, BasicBuffer<Allocator> &out)
+  {
+    File f{path, FileMode::read, FileType::binary, FileBackend::native};
+    f.read_all_into(out);
+  }
+
+  /**
+   * @brief Map an entire file read-only.
+   *
+   * Unlike `read_file_binary()`, no copy is made: the returned view exposes the
+   * file pages directly and they are loaded on demand.
+   *
+   * @param path Path to the file.
+   * @return Read-only mapping of the file content.
+   * @throws std::system_error If opening or mapping fails.
+   */
+  [[nodiscard]] inline MappedFile read_file_mapped(const std::filesystem::path &path)
+  {
+    return MappedFile{path};
+  }
+
   /**
    * @brief Try to read an entire file as text.
    *
@@ -0,0 +1,286 @@
+/**
+ * @file task.hpp
+ * @brief Minimal lazy coroutine task, executor hook and blocking wait.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_TASK_HPP
+#define RIX_IO_TASK_HPP
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rix::io
+{
+  template <class T = void>
+  class Task;
+
+  /**
+   * @brief Anything that can run a callable later: `ex.post(std::function<void()>)`.
+   *
+   * `rix::io::ThreadPool` satisfies it.
+   */
+  template <class E>
+  concept Executor = requires(E &ex, std::function<void()> fn) {
+    ex.post(std::move(fn));
+  };
+
+  namespace detail
+  {
+    struct TaskPromiseBase
+    {
+      std::coroutine_handle<> continuation{std::noop_coroutine()};
+      std::exception_ptr error{};
+
+      struct FinalAwaiter
+      {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <class Promise>
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) const noexcept
+        {
+          return h.promise().continuation;
+        }
+
+        void await_resume() const noexcept {}
+      };
+
+      [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+      [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+      void unhandled_exception() noexcept { error = std::current_exception(); }
+
+      void rethrow_if_failed() const
+      {
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+      }
+    };
+
+    template <class T>
+    struct TaskPromise : TaskPromiseBase
+    {
+      std::optional<T> value{};
+
+      Task<T> get_return_object() noexcept;
+
+      template <class U>
+      void return_value(U &&v)
+      {
+        value.emplace(std::forward<U>(v));
+      }
+
+      [[nodiscard]] T result()
+      {
+        rethrow_if_failed();
+        return std::move(*value);
+      }
+    };
+
+    template <>
+    struct TaskPromise<void> : TaskPromiseBase
+    {
+      Task<void> get_return_object() noexcept;
+
+      void return_void() const noexcept {}
+
+      void result() const { rethrow_if_failed(); }
+    };
+  } // namespace detail
+
+  /**
+   * @brief Lazy coroutine producing a `T`.
+   *
+   * The body starts when the task is awaited (or passed to `sync_wait()`)
+   * and resumes the awaiting coroutine when it finishes. Exceptions thrown
+   * by the body are rethrown to the awaiter.
+   */
+  template <class T>
+  class [[nodiscard]] Task
+  {
+  public:
+    using promise_type = detail::TaskPromise<T>;
+    using value_type = T;
+
+    Task() = default;
+
+    explicit Task(std::coroutine_handle<promise_type> h) noexcept
+        : h_(h)
+    {
+    }
+
+    ~Task() noexcept
+    {
+      if (h_)
+      {
+        h_.destroy();
+      }
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    Task(Task &&other) noexcept
+        : h_(std::exchange(other.h_, {}))
+    {
+    }
+
+    Task &operator=(Task &&other) noexcept
+    {
+      if (this != &other)
+      {
+        if (h_)
+        {
+          h_.destroy();
+        }
+        h_ = std::exchange(other.h_, {});
+      }
+      return *this;
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return static_cast<bool>(h_); }
+
+    [[nodiscard]] bool await_ready() const noexcept { return !h_ || h_.done(); }
+
+    [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+      h_.promise().continuation = awaiting;
+      return h_;
+    }
+
+    T await_resume() { return h_.promise().result(); }
+
+  private:
+    std::coroutine_handle<promise_type> h_{};
+  };
+
+  namespace detail
+  {
+    template <class T>
+    inline Task<T> TaskPromise<T>::get_return_object() noexcept
+    {
+      return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept
+    {
+      return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+
+    struct SyncWaitState
+    {
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::exception_ptr error{};
+      bool done{false};
+    };
+
+    struct SyncWaitDriver
+    {
+      struct promise_type
+      {
+        SyncWaitDriver get_return_object() const noexcept { return {}; }
+        [[nodiscard]] std::suspend_never initial_suspend() const noexcept { return {}; }
+        [[nodiscard]] std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+      };
+    };
+
+    template <class T, class Out>
+    SyncWaitDriver sync_wait_drive(Task<T> &task, Out &out, SyncWaitState &state)
+    {
+      try
+      {
+        if constexpr (std::is_void_v<T>)
+        {
+          co_await task;
+        }
+        else
+        {
+          out.emplace(co_await task);
+        }
+      }
+      catch (...)
+      {
+        state.error = std::current_exception();
+      }
+
+      // Notify under the lock: the waiter may destroy `state` as soon as it can reacquire it.
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.done = true;
+      state.cv.notify_all();
+    }
+  } // namespace detail
+
+  /**
+   * @brief Awaitable that resumes the awaiting coroutine on `ex`.
+   */
+  template <Executor E>
+  [[nodiscard]] auto schedule_on(E &ex) noexcept
+  {
+    struct Awaiter
+    {
+      E *ex;
+
+      [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+      void await_suspend(std::coroutine_handle<> h) const
+      {
+        ex->post([h]
+                 { h.resume(); });
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    return Awaiter{&ex};
+  }
+
+  /**
+   * @brief Run `task` to completion, blocking the calling thread.
+   *
+   * @return The task result.
+   * @throws Whatever the task body threw.
+   */
+  template <class T>
+  T sync_wait(Task<T> task)
+  {
+    detail::SyncWaitState state;
+    std::optional<std::conditional_t<std::is_void_v<T>, char, T>> out;
+
+    detail::sync_wait_drive(task, out, state);
+
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.cv.wait(lock, [&state]
+                    { return state.done; });
+    }
+
+    if (state.error)
+    {
+      std::rethrow_exception(state.error);
+    }
+
+    if constexpr (!std::is_void_v<T>)
+    {
+      return std::move(*out);
+    }
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_TASK_HPP
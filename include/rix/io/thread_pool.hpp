@@ -0,0 +1,161 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Small fixed-size worker pool used by the asynchronous and batch helpers.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_THREAD_POOL_HPP
+#define RIX_IO_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rix::io
+{
+  /**
+   * @brief Fixed-size pool of worker threads executing posted tasks in FIFO order.
+   *
+   * Tasks must not throw; an escaping exception terminates the program.
+   * The destructor drains every posted task, then joins the workers.
+   */
+  class ThreadPool
+  {
+  public:
+    /**
+     * @brief Start `threads` workers (hardware concurrency if 0).
+     */
+    explicit ThreadPool(std::size_t threads = 0)
+    {
+      if (threads == 0)
+      {
+        threads = default_thread_count();
+      }
+
+      workers_.reserve(threads);
+      for (std::size_t i = 0; i < threads; ++i)
+      {
+        workers_.emplace_back([this]
+                              { run(); });
+      }
+    }
+
+    /**
+     * @brief Run remaining tasks and join all workers.
+     */
+    ~ThreadPool() noexcept
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+      }
+      work_cv_.notify_all();
+
+      for (auto &t : workers_)
+      {
+        if (t.joinable())
+        {
+          t.join();
+        }
+      }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Queue `task` for execution on a worker.
+     *
+     * @throws std::runtime_error if the pool is shutting down.
+     */
+    void post(std::function<void()> task)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_)
+        {
+          throw std::runtime_error("rix::io::ThreadPool: post after shutdown");
+        }
+        tasks_.push_back(std::move(task));
+        ++pending_;
+      }
+      work_cv_.notify_one();
+    }
+
+    /**
+     * @brief Block until every posted task, including tasks posted by tasks, has finished.
+     */
+    void wait_idle()
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      idle_cv_.wait(lock, [this]
+                    { return pending_ == 0; });
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return workers_.size(); }
+
+    /**
+     * @brief Hardware concurrency, at least 1.
+     */
+    [[nodiscard]] static std::size_t default_thread_count() noexcept
+    {
+      const unsigned n = std::thread::hardware_concurrency();
+      return n == 0 ? 1 : static_cast<std::size_t>(n);
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> workers_;
+    std::size_t pending_{0};
+    bool stopping_{false};
+
+    void run() noexcept
+    {
+      for (;;)
+      {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          work_cv_.wait(lock, [this]
+                        { return stopping_ || !tasks_.empty(); });
+
+          if (tasks_.empty())
+          {
+            return;
+          }
+
+          task = std::move(tasks_.front());
+          tasks_.pop_front();
+        }
+
+        task();
+
+        bool idle = false;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          idle = (--pending_ == 0);
+        }
+        if (idle)
+        {
+          idle_cv_.notify_all();
+        }
+      }
+    }
+  };
+
+} // namespace rix::io
+
+#endif // RIX_IO_THREAD_POOL_HPP
@@ -11,14 +11,40 @@
 #ifndef RIX_IO_UTIL_HPP
 #define RIX_IO_UTIL_HPP
 
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <new>
 #include <random>
 #include <string>
 #include <string_view>
 #include <system_error>
 
+#include <rix/io/file.hpp>
+#include <rix/io/native_handle.hpp>
+
+#if defined(_WIN32)
+// <windows.h> is provided by native_handle.hpp.
+#elif defined(__APPLE__)
+#include <copyfile.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
 namespace rix::io
 {
   /**
@@ -60,16 +86,126 @@ namespace rix::io
     return size;
   }
 
+  namespace detail
+  {
+    /**
+     * @brief Bijective 64-bit mixer (SplitMix64 finalizer): distinct inputs give distinct outputs.
+     */
+    [[nodiscard]] constexpr std::uint64_t mix64(std::uint64_t x) noexcept
+    {
+      x ^= x >> 30;
+      x *= 0xBF58476D1CE4E5B9ull;
+      x ^= x >> 27;
+      x *= 0x94D049BB133111EBull;
+      x ^= x >> 31;
+      return x;
+    }
+
+    /**
+     * @brief Random per-process key, drawn once.
+     */
+    [[nodiscard]] inline std::uint64_t temp_name_key() noexcept
+    {
+      static const std::uint64_t key = []() noexcept
+      {
+        std::uint64_t k = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        try
+        {
+          std::random_device rd;
+          k ^= (static_cast<std::uint64_t>(rd()) << 32) | rd();
+        }
+        catch (...)
+        {
+        }
+        return mix64(k);
+      }();
+      return key;
+    }
+
+    [[nodiscard]] inline std::uint64_t current_process_id() noexcept
+    {
+#if defined(_WIN32)
+      return static_cast<std::uint64_t>(::GetCurrentProcessId());
+#else
+      return static_cast<std::uint64_t>(::getpid());
+#endif
+    }
+
+    /**
+     * @brief Next number of a sequence unique across threads of this process.
+     *
+     * Each thread reserves a range of 2^32 values with one atomic increment
+     * and then counts locally, so concurrent callers never share a cache line.
+     */
+    [[nodiscard]] inline std::uint64_t next_temp_sequence() noexcept
+    {
+      static std::atomic<std::uint64_t> ranges{0};
+      thread_local std::uint64_t next = ranges.fetch_add(1, std::memory_order_relaxed) << 32;
+      return next++;
+    }
+
+    /**
+     * @brief `<prefix>_<process key>_<sequence>.tmp`, both numbers in hex.
+     *
+     * The process id is folded into the key so forked children, which
+     * inherit the key and counters, still produce distinct names.
+     */
+    [[nodiscard]] inline std::string temp_file_name(std::string_view prefix)
+    {
+      const std::uint64_t key = temp_name_key() ^ mix64(current_process_id());
+      const std::uint64_t seq = mix64(next_temp_sequence());
+
+      std::array<char, 2 * 16 + 2 + 4> digits{};
+      char *p = digits.data();
+      *p++ = '_';
+      p = std::to_chars(p, digits.data() + digits.size(), key, 16).ptr;
+      *p++ = '_';
+      p = std::to_chars(p, digits.data() + digits.size(), seq, 16).ptr;
+
+      std::string name;
+      name.reserve(prefix.size() + static_cast<std::size_t>(p - digits.data()) + 4);
+      name.append(prefix);
+      name.append(digits.data(), p);
+      name.append(".tmp");
+      return name;
+    }
+
+    /**
+     * @brief `std::filesystem::temp_directory_path()`, looked up on first use only.
+     */
+    [[nodiscard]] inline const std::filesystem::path &temp_directory()
+    {
+      static const std::filesystem::path dir = std::filesystem::temp_directory_path();
+      return dir;
+    }
+  } // namespace detail
+
   /**
-   * @brief Generate a temporary file path.
+   * @brief Generate a temporary file path inside `dir`.
    *
-   * The path is constructed inside the system temporary directory.
+   * Same naming scheme as `temp_path(prefix)`. Useful for a sibling of a
+   * target file, on the same filesystem, that can later be renamed over it.
    * The file is not created.
+   */
+  [[nodiscard]] inline std::filesystem::path temp_path(const std::filesystem::path &dir, std::string_view prefix)
+  {
+    return dir / detail::temp_file_name(prefix);
+  }
+
+  /**
+   * @brief Generate a temporary file path.
+   *
+   * The path is constructed inside the system temporary directory, which is
+   * looked up once per process; later changes to `TMPDIR` are not seen.
+   * The file is not created: use `create_temp_file()` to also claim the name.
    *
    * The generated name is composed of:
    * - prefix
-   * - monotonic timestamp
-   * - random value
+   * - a random per-process key
+   * - a sequence number unique across the threads of the process
+   *
+   * Generating a name takes no lock and, after a thread's first call, no
+   * atomic operation.
    *
    * @param prefix Prefix for the file name.
    * @return A unique temporary path.
@@ -79,24 +215,361 @@ namespace rix::io
    */
   [[nodiscard]] inline std::filesystem::path temp_path(std::string_view prefix = "rix")
   {
-    const auto base = std::filesystem::temp_directory_path();
+    return temp_path(detail::temp_directory(), prefix);
+  }
 
-    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  namespace detail
+  {
+    /**
+     * @brief Exclusively create a file at the first free name returned by `next_name()`.
+     *
+     * Each name is claimed with `FileFlags::exclusive`, so an existing file or
+     * symlink at that name is never opened, truncated or followed; the next
+     * name is tried instead, up to 16 in total.
+     *
+     * @throws std::system_error If creation fails for another reason, or every name is taken.
+     */
+    template <class NameFn>
+    [[nodiscard]] File create_new_file(NameFn &&next_name, FileMode mode, FileType type)
+    {
+      for (int attempt = 0;; ++attempt)
+      {
+        try
+        {
+          return File{next_name(), mode, type, FileBackend::native, FileFlags::exclusive};
+        }
+        catch (const std::system_error &e)
+        {
+          if (e.code() != std::errc::file_exists || attempt == 15)
+          {
+            throw;
+          }
+        }
+      }
+    }
+  } // namespace detail
 
-    std::mt19937_64 rng(static_cast<std::mt19937_64::result_type>(now));
-    const auto rand_val = rng();
+  /**
+   * @brief Create and open a new temporary file inside `dir`.
+   *
+   * The name is generated as by `temp_path()` and claimed with an exclusive
+   * create (`O_CREAT | O_EXCL`, like `mkstemp`), so no other process can
+   * slip in between choosing the name and opening it. The file is opened
+   * with `FileMode::read_write`, `FileType::binary` and `FileBackend::native`;
+   * its path is `File::path()`. The caller removes it when done.
+   *
+   * @throws std::system_error If the file cannot be created.
+   */
+  [[nodiscard]] inline File create_temp_file(const std::filesystem::path &dir, std::string_view prefix)
+  {
+    // Names are unique per process; a clash means another process reused one.
+    return detail::create_new_file([&]
+                                   { return temp_path(dir, prefix); },
+                                   FileMode::read_write, FileType::binary);
+  }
 
-    std::string name;
-    name.reserve(prefix.size() + 32);
+  /**
+   * @brief Create and open a new temporary file in the system temporary directory.
+   *
+   * @throws std::filesystem::filesystem_error If the system temporary directory
+   *         cannot be determined.
+   * @throws std::system_error If the file cannot be created.
+   */
+  [[nodiscard]] inline File create_temp_file(std::string_view prefix = "rix")
+  {
+    return create_temp_file(detail::temp_directory(), prefix);
+  }
 
-    name.append(prefix);
-    name.push_back('_');
-    name.append(std::to_string(now));
-    name.push_back('_');
-    name.append(std::to_string(rand_val));
-    name.append(".tmp");
+  /**
+   * @brief Options for `path_copy()`.
+   */
+  struct PathCopyOptions
+  {
+    /**
+     * @brief Replace `dst` if it already exists. When false, an existing `dst` is an error.
+     */
+    bool overwrite{true};
+
+    /**
+     * @brief Allow a copy-on-write clone (reflink) when the filesystem supports it.
+     */
+    bool allow_clone{true};
+  };
+
+  namespace detail
+  {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    /**
+     * @brief Copy the rest of `in` into `out` through a userspace buffer.
+     */
+    inline std::uint64_t copy_fd_streaming(int in, int out, std::error_code &ec) noexcept
+    {
+      constexpr std::size_t chunk = 1 << 20;
+      const std::unique_ptr<std::byte[]> buf(new (std::nothrow) std::byte[chunk]);
+      if (!buf)
+      {
+        ec = std::make_error_code(std::errc::not_enough_memory);
+        return 0;
+      }
+
+      std::uint64_t total = 0;
+      for (;;)
+      {
+        const ::ssize_t r = ::read(in, buf.get(), chunk);
+        if (r < 0)
+        {
+          if (errno == EINTR)
+          {
+            continue;
+          }
+          ec = last_os_error();
+          return total;
+        }
+        if (r == 0)
+        {
+          return total;
+        }
+
+        std::size_t done = 0;
+        while (done < static_cast<std::size_t>(r))
+        {
+          const ::ssize_t w = ::write(out, buf.get() + done, static_cast<std::size_t>(r) - done);
+          if (w < 0)
+          {
+            if (errno == EINTR)
+            {
+              continue;
+            }
+            ec = last_os_error();
+            return total;
+          }
+          if (w == 0)
+          {
+            ec = std::make_error_code(std::errc::io_error);
+            return total;
+          }
+          done += static_cast<std::size_t>(w);
+        }
+        total += done;
+      }
+    }
+
+#if defined(__linux__)
+    [[nodiscard]] inline bool copy_fallback_errno(int err) noexcept
+    {
+      return err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP ||
+             err == EPERM || err == ENOTSUP || err == EBADF;
+    }
+
+    /**
+     * @brief Kernel-side copy: `copy_file_range`, then `sendfile`.
+     *
+     * @return false if neither is usable and nothing was copied (caller falls back).
+     */
+    [[nodiscard]] inline bool copy_fd_kernel(int in, int out, std::uint64_t &total, std::error_code &ec) noexcept
+    {
+      constexpr std::size_t chunk = std::size_t{1} << 30;
+
+#if defined(SYS_copy_file_range)
+      for (;;)
+      {
+        const long r = ::syscall(SYS_copy_file_range, in, nullptr, out, nullptr, chunk, 0u);
+        if (r > 0)
+        {
+          total += static_cast<std::uint64_t>(r);
+          continue;
+        }
+        if (r == 0)
+        {
+          return true;
+        }
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        if (total != 0 || !copy_fallback_errno(errno))
+        {
+          ec = last_os_error();
+          return true;
+        }
+        break;
+      }
+#endif
+
+      for (;;)
+      {
+        const ::ssize_t r = ::sendfile(out, in, nullptr, chunk);
+        if (r > 0)
+        {
+          total += static_cast<std::uint64_t>(r);
+          continue;
+        }
+        if (r == 0)
+        {
+          return true;
+        }
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        if (total != 0 || !copy_fallback_errno(errno))
+        {
+          ec = last_os_error();
+          return true;
+        }
+        return false;
+      }
+    }
+#endif
+#endif
+
+    inline std::uint64_t copy_file_native(const std::filesystem::path &src,
+                                          const std::filesystem::path &dst,
+                                          const PathCopyOptions &options,
+                                          std::error_code &ec) noexcept
+    {
+      ec.clear();
+
+#if defined(_WIN32)
+      const DWORD flags = options.overwrite ? 0 : COPY_FILE_FAIL_IF_EXISTS;
+      if (!::CopyFileExW(src.c_str(), dst.c_str(), nullptr, nullptr, nullptr, flags))
+      {
+        ec = last_os_error();
+        return 0;
+      }
+      return static_cast<std::uint64_t>(std::filesystem::file_size(dst, ec));
+#elif defined(__APPLE__)
+      ::copyfile_flags_t flags = COPYFILE_ALL;
+      if (options.allow_clone)
+      {
+        flags |= COPYFILE_CLONE;
+      }
+      if (!options.overwrite)
+      {
+        flags |= COPYFILE_EXCL;
+      }
+      if (::copyfile(src.c_str(), dst.c_str(), nullptr, flags) != 0)
+      {
+        ec = last_os_error();
+        return 0;
+      }
+      return static_cast<std::uint64_t>(std::filesystem::file_size(dst, ec));
+#else
+      int in = -1;
+      do
+      {
+        in = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+      } while (in < 0 && errno == EINTR);
+      if (in < 0)
+      {
+        ec = last_os_error();
+        return 0;
+      }
+
+      struct ::stat st{};
+      if (::fstat(in, &st) != 0)
+      {
+        ec = last_os_error();
+        ::close(in);
+        return 0;
+      }
+
+      const int oflags = O_WRONLY | O_CREAT | O_CLOEXEC | (options.overwrite ? O_TRUNC : O_EXCL);
+      int out = -1;
+      do
+      {
+        out = ::open(dst.c_str(), oflags, st.st_mode & 0777);
+      } while (out < 0 && errno == EINTR);
+      if (out < 0)
+      {
+        ec = last_os_error();
+        ::close(in);
+        return 0;
+      }
+
+      std::uint64_t total = 0;
+      bool done = false;
+
+#if defined(__linux__)
+#if defined(FICLONE)
+      if (options.allow_clone && S_ISREG(st.st_mode) && ::ioctl(out, FICLONE, in) == 0)
+      {
+        total = static_cast<std::uint64_t>(st.st_size);
+        done = true;
+      }
+#endif
+      // Files reporting a size of 0 (procfs) are copied through userspace.
+      if (!done && S_ISREG(st.st_mode) && st.st_size > 0)
+      {
+        done = copy_fd_kernel(in, out, total, ec);
+      }
+#endif
+
+      if (!done)
+      {
+        total += copy_fd_streaming(in, out, ec);
+      }
+
+      if (::close(out) != 0 && !ec)
+      {
+        ec = last_os_error();
+      }
+      ::close(in);
+      return total;
+#endif
+    }
+  } // namespace detail
+
+  /**
+   * @brief Copy the content of `src` to `dst`.
+   *
+   * Uses the fastest mechanism the platform offers, keeping the data out of
+   * userspace whenever possible:
+   * - Linux: `FICLONE` reflink, then `copy_file_range`, then `sendfile`
+   * - macOS: `copyfile` (with `COPYFILE_CLONE` when cloning is allowed)
+   * - Windows: `CopyFileEx`
+   * - otherwise, or when the fast paths are unavailable: a chunked read/write loop
+   *
+   * Memory use stays bounded regardless of the file size. On failure, `dst`
+   * may be left partially written.
+   *
+   * Named `path_copy` rather than `copy_file` so unqualified calls do not
+   * collide with `std::filesystem::copy_file` through ADL.
+   *
+   * @param src Source file.
+   * @param dst Destination file.
+   * @param options Overwrite and clone policy.
+   * @return Number of bytes copied.
+   *
+   * @throws std::filesystem::filesystem_error If `src` and `dst` are the same file,
+   *         or if the copy fails.
+   */
+  inline std::uintmax_t path_copy(const std::filesystem::path &src,
+                                  const std::filesystem::path &dst,
+                                  const PathCopyOptions &options = {})
+  {
+    std::error_code ec;
+    if (std::filesystem::equivalent(src, dst, ec))
+    {
+      throw std::filesystem::filesystem_error(
+          "rix::io::path_copy failed",
+          src,
+          dst,
+          std::make_error_code(std::errc::invalid_argument));
+    }
+
+    const auto copied = detail::copy_file_native(src, dst, options, ec);
+
+    if (ec)
+    {
+      throw std::filesystem::filesystem_error(
+          "rix::io::path_copy failed",
+          src,
+          dst,
+          ec);
+    }
 
-    return base / name;
+    return static_cast<std::uintmax_t>(copied);
   }
 
   /**
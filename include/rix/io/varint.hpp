@@ -0,0 +1,148 @@
+/**
+ * @file varint.hpp
+ * @brief LEB128 variable-length integer encoding and ZigZag mapping.
+ *
+ * Copyright 2026, Gaspard Kirira.
+ * https://github.com/rixcpp/rix
+ *
+ * Use of this source code is governed by the MIT license.
+ */
+
+#ifndef RIX_IO_VARINT_HPP
+#define RIX_IO_VARINT_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <rix/io/endian.hpp>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace rix::io
+{
+  /**
+   * @brief Longest LEB128 encoding of a 64-bit value.
+   */
+  inline constexpr std::size_t max_varint_size = 10;
+
+  /**
+   * @brief Number of bytes `encode_varint(v)` produces.
+   */
+  [[nodiscard]] constexpr std::size_t varint_size(std::uint64_t v) noexcept
+  {
+    // 1 + floor(bit_width / 7), with 0 encoded on one byte.
+    return 1 + static_cast<std::size_t>((std::bit_width(v | 1) - 1) / 7);
+  }
+
+  /**
+   * @brief Map a signed value to unsigned so small magnitudes encode short.
+   */
+  [[nodiscard]] constexpr std::uint64_t zigzag_encode(std::int64_t v) noexcept
+  {
+    return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+  }
+
+  [[nodiscard]] constexpr std::int64_t zigzag_decode(std::uint64_t v) noexcept
+  {
+    return static_cast<std::int64_t>((v >> 1) ^ (~(v & 1) + 1));
+  }
+
+  /**
+   * @brief Encode `v` as unsigned LEB128 into `out` (at least `max_varint_size` bytes).
+   *
+   * @return Number of bytes written.
+   */
+  inline std::size_t encode_varint(std::uint64_t v, std::byte *out) noexcept
+  {
+    std::size_t n = 0;
+    while (v >= 0x80)
+    {
+      out[n++] = static_cast<std::byte>(v | 0x80);
+      v >>= 7;
+    }
+    out[n++] = static_cast<std::byte>(v);
+    return n;
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief Pack the low 7 bits of each of the 8 bytes of `w` into 56 contiguous bits.
+     */
+    [[nodiscard]] inline std::uint64_t compact_varint_groups(std::uint64_t w) noexcept
+    {
+#if defined(__BMI2__)
+      return _pext_u64(w, 0x7F7F7F7F7F7F7F7Full);
+#else
+      w &= 0x7F7F7F7F7F7F7F7Full;
+      w = ((w & 0x7F007F007F007F00ull) >> 1) | (w & 0x007F007F007F007Full);
+      w = ((w & 0x3FFF00003FFF0000ull) >> 2) | (w & 0x00003FFF00003FFFull);
+      w = ((w & 0x0FFFFFFF00000000ull) >> 4) | (w & 0x000000000FFFFFFFull);
+      return w;
+#endif
+    }
+  } // namespace detail
+
+  /**
+   * @brief Decode one unsigned LEB128 value from the front of `in`.
+   *
+   * Values of up to 8 encoded bytes (56 bits) are decoded from a single
+   * 64-bit load without a per-byte loop when at least 8 bytes are available.
+   *
+   * @return Bytes consumed, or 0 if `in` is truncated or the value overflows 64 bits.
+   */
+  [[nodiscard]] inline std::size_t decode_varint(std::span<const std::byte> in, std::uint64_t &out) noexcept
+  {
+    if (in.empty())
+    {
+      return 0;
+    }
+
+    const auto first = static_cast<std::uint8_t>(in[0]);
+    if (first < 0x80)
+    {
+      out = first;
+      return 1;
+    }
+
+    if (in.size() >= 8)
+    {
+      const auto word = detail::load_endian<std::endian::little, std::uint64_t>(in.data());
+      const std::uint64_t stops = ~word & 0x8080808080808080ull;
+      if (stops != 0)
+      {
+        const auto len = static_cast<std::size_t>(std::countr_zero(stops) / 8 + 1);
+        const std::uint64_t keep = (len == 8) ? ~std::uint64_t{0} : ((std::uint64_t{1} << (len * 8)) - 1);
+        out = detail::compact_varint_groups(word & keep);
+        return len;
+      }
+    }
+
+    std::uint64_t v = 0;
+    const std::size_t limit = in.size() < max_varint_size ? in.size() : max_varint_size;
+    for (std::size_t i = 0; i < limit; ++i)
+    {
+      const auto b = static_cast<std::uint8_t>(in[i]);
+      if (i == max_varint_size - 1 && b > 1)
+      {
+        return 0;
+      }
+
+      v |= static_cast<std::uint64_t>(b & 0x7F) << (7 * i);
+      if (b < 0x80)
+      {
+        out = v;
+        return i + 1;
+      }
+    }
+
+    return 0;
+  }
+
+} // namespace rix::io
+
+#endif // RIX_IO_VARINT_HPP
@@ -14,9 +14,14 @@
 #include <cstddef>
 #include <filesystem>
 #include <span>
+#include <string>
 #include <string_view>
+#include <system_error>
 
 #include <rix/io/file.hpp>
+#include <rix/io/group_commit.hpp>
+#include <rix/io/native_handle.hpp>
+#include <rix/io/util.hpp>
 
 namespace rix::io
 {
@@ -26,7 +31,32 @@ namespace rix::io
   enum class WriteMode
   {
     truncate,
-    append
+    append,
+
+    /**
+     * @brief Write a sibling temporary file, sync it, then rename it over the target.
+     *
+     * Readers see either the old or the new content, never a torn file.
+     */
+    atomic_replace
+  };
+
+  /**
+   * @brief Options for `write_file_atomic()`.
+   */
+  struct AtomicWriteOptions
+  {
+    /**
+     * @brief Sync the data before the rename and the directory after it.
+     *
+     * Without it the replacement is still atomic but may be lost on power failure.
+     */
+    bool durable{true};
+
+    /**
+     * @brief Share the syncs with concurrent writers (must outlive the call).
+     */
+    GroupCommit *group{nullptr};
   };
 
   namespace detail
@@ -35,17 +65,175 @@ namespace rix::io
     {
       return (mode == WriteMode::append) ? FileMode::append : FileMode::write;
     }
+
+    /**
+     * @brief Payload size from which whole-file writes reserve their extents first.
+     */
+    inline constexpr std::size_t preallocate_threshold = 1024 * 1024;
+
+    [[nodiscard]] inline std::filesystem::path parent_or_current(const std::filesystem::path &path)
+    {
+      const auto parent = path.parent_path();
+      return parent.empty() ? std::filesystem::path(".") : parent;
+    }
+
+    /**
+     * @brief Hidden temporary path next to `target`, on the same filesystem.
+     */
+    [[nodiscard]] inline std::filesystem::path atomic_sibling(const std::filesystem::path &target)
+    {
+      return temp_path(parent_or_current(target), "." + target.filename().string());
+    }
+
+    /**
+     * @brief Create and open a fresh `atomic_sibling()` of `target` for writing.
+     *
+     * The name is claimed exclusively: a stale temporary or a planted symlink
+     * under that name is left alone and another name is picked.
+     *
+     * @throws std::system_error If the file cannot be created.
+     */
+    [[nodiscard]] inline File create_atomic_sibling(const std::filesystem::path &target, FileType type)
+    {
+      return create_new_file([&]
+                             { return atomic_sibling(target); },
+                             FileMode::write, type);
+    }
+
+    inline void sync_for_commit(File &file, const AtomicWriteOptions &options)
+    {
+      if (!options.durable)
+      {
+        return;
+      }
+
+      if (options.group != nullptr)
+      {
+        options.group->sync(file);
+      }
+      else
+      {
+        file.sync_data();
+      }
+    }
+
+    /**
+     * @brief Rename the finished temporary file over `target` and make the rename durable.
+     *
+     * The existing target's permissions are carried over. `tmp` is removed if the rename fails.
+     *
+     * @throws std::filesystem::filesystem_error if the rename fails.
+     * @throws std::system_error if syncing the directory fails.
+     */
+    inline void commit_atomic(const std::filesystem::path &tmp,
+                              const std::filesystem::path &target,
+                              const AtomicWriteOptions &options)
+    {
+      std::error_code ec;
+      const auto st = std::filesystem::status(target, ec);
+      if (!ec && std::filesystem::exists(st))
+      {
+        std::filesystem::permissions(tmp, st.permissions(), ec);
+      }
+
+      std::filesystem::rename(tmp, target, ec);
+      if (ec)
+      {
+        std::error_code ignore;
+        std::filesystem::remove(tmp, ignore);
+        throw std::filesystem::filesystem_error("rix::io: atomic replace failed", tmp, target, ec);
+      }
+
+      if (!options.durable)
+      {
+        return;
+      }
+
+      const auto dir = parent_or_current(target);
+      if (options.group != nullptr)
+      {
+        options.group->sync_directory(dir);
+        return;
+      }
+
+      sync_directory(dir, ec);
+      if (ec)
+      {
+        throw std::system_error(ec, "rix::io: directory sync failed: " + dir.string());
+      }
+    }
+
+    inline void write_atomic(const std::filesystem::path &target,
+                             std::span<const std::byte> bytes,
+                             const AtomicWriteOptions &options)
+    {
+      std::filesystem::path tmp;
+      try
+      {
+        File f = create_atomic_sibling(target, FileType::binary);
+        tmp = f.path();
+        if (bytes.size() >= preallocate_threshold)
+        {
+          (void)f.preallocate(bytes.size());
+        }
+        f.write(bytes);
+        sync_for_commit(f, options);
+      }
+      catch (...)
+      {
+        if (!tmp.empty())
+        {
+          std::error_code ignore;
+          std::filesystem::remove(tmp, ignore);
+        }
+        throw;
+      }
+
+      commit_atomic(tmp, target, options);
+    }
   } // namespace detail
 
+  /**
+   * @brief Atomically replace a file's content with `bytes`.
+   *
+   * Writes a hidden sibling temporary file, syncs it (unless
+   * `options.durable` is false), renames it over `path` and syncs the parent
+   * directory. A crash leaves either the old or the new content.
+   *
+   * @throws std::system_error If opening or syncing fails.
+   * @throws std::runtime_error If writing fails.
+   * @throws std::filesystem::filesystem_error If the rename fails.
+   */
+  inline void write_file_atomic(const std::filesystem::path &path,
+                                std::span<const std::byte> bytes,
+                                const AtomicWriteOptions &options = {})
+  {
+    detail::write_atomic(path, bytes, options);
+  }
+
+  /**
+   * @brief Atomically replace a file's content with `text` (no newline translation).
+   *
+   * @see write_file_atomic(const std::filesystem::path &, std::span<const std::byte>, const AtomicWriteOptions &)
+   */
+  inline void write_file_atomic(const std::filesystem::path &path,
+                                std::string_view text,
+                                const AtomicWriteOptions &options = {})
+  {
+    const std::span<const std::byte> bytes(reinterpret_cast<const std::byte *>(text.data()), text.size());
+    detail::write_atomic(path, bytes, options);
+  }
+
   /**
    * @brief Write text to a file.
    *
    * Opens the file with `FileType::text` and the requested write mode, writes all bytes,
-   * and flushes the stream.
+   * and flushes the stream. `WriteMode::atomic_replace` goes through
+   * `write_file_atomic()` instead, without newline translation.
    *
    * @param path Path to the file.
    * @param text Text to write.
-   * @param mode Write mode (truncate or append).
+   * @param mode Write mode (truncate, append or atomic_replace).
    *
    * @throws std::system_error If opening fails.
    * @throws std::runtime_error If writing or flushing fails.
@@ -54,6 +242,12 @@ namespace rix::io
                               std::string_view text,
                               WriteMode mode = WriteMode::truncate)
   {
+    if (mode == WriteMode::atomic_replace)
+    {
+      write_file_atomic(path, text);
+      return;
+    }
+
     File f{path, detail::to_file_mode(mode), FileType::text};
     f.write(text);
     f.flush();
@@ -62,12 +256,14 @@ namespace rix::io
   /**
    * @brief Write bytes to a file.
    *
-   * Opens the file with `FileType::binary` and the requested write mode, writes all bytes,
-   * and flushes the stream.
+   * Opens the file with `FileType::binary`, `FileBackend::native` and the requested
+   * write mode, and writes all bytes. Payloads of 1 MiB or more are preallocated
+   * before writing. `WriteMode::atomic_replace` goes through
+   * `write_file_atomic()` with default (durable) options.
    *
    * @param path Path to the file.
    * @param bytes Bytes to write.
-   * @param mode Write mode (truncate or append).
+   * @param mode Write mode (truncate, append or atomic_replace).
    *
    * @throws std::system_error If opening fails.
    * @throws std::runtime_error If writing or flushing fails.
@@ -76,9 +272,18 @@ namespace rix::io
                                 std::span<const std::byte> bytes,
                                 WriteMode mode = WriteMode::truncate)
   {
-    File f{path, detail::to_file_mode(mode), FileType::binary};
+    if (mode == WriteMode::atomic_replace)
+    {
+      write_file_atomic(path, bytes);
+      return;
+    }
+
+    File f{path, detail::to_file_mode(mode), FileType::binary, FileBackend::native};
+    if (bytes.size() >= detail::preallocate_threshold)
+    {
+      (void)f.preallocate(f.size() + bytes.size());
+    }
     f.write(bytes);
-    f.flush();
   }
 
   /**
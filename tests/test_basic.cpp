@@ -1,13 +1,49 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <filesystem>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <vector>
 
+#include <rix/io/async.hpp>
+#include <rix/io/access_pattern.hpp>
+#include <rix/io/async_file.hpp>
+#include <rix/io/batch_reader.hpp>
 #include <rix/io/buffer.hpp>
+#include <rix/io/buffer_chain.hpp>
+#include <rix/io/buffer_pool.hpp>
+#include <rix/io/buffer_reader.hpp>
+#include <rix/io/buffered_writer.hpp>
+#include <rix/io/chunk_reader.hpp>
+#include <rix/io/compression.hpp>
+#include <rix/io/directory_walker.hpp>
+#include <rix/io/endian.hpp>
 #include <rix/io/file.hpp>
+#include <rix/io/file_cache.hpp>
+#include <rix/io/group_commit.hpp>
+#include <rix/io/hash.hpp>
+#include <rix/io/inline_buffer.hpp>
+#include <rix/io/io_stats.hpp>
+#include <rix/io/line_reader.hpp>
+#include <rix/io/mapped_file.hpp>
 #include <rix/io/reader.hpp>
+#include <rix/io/task.hpp>
+#include <rix/io/thread_pool.hpp>
 #include <rix/io/util.hpp>
 #include <rix/io/writer.hpp>
 
@@ -155,6 +191,1740 @@ static void test_try_read_helpers()
   assert(!b.has_value());
 }
 
+static void test_mapped_file()
+{
+  const fs::path p = rix::io::temp_path("rix_io_map");
+
+  rix::io::write_file_text(p, "mapped content");
+
+  {
+    const auto m = rix::io::read_file_mapped(p);
+    assert(m.is_open());
+    assert(m.size() == 14);
+    assert(m.as_string_view() == "mapped content");
+    assert(m.span().size() == m.size());
+  }
+
+  rix::io::write_file_text(p, "");
+
+  {
+    rix::io::MappedFile m{p};
+    assert(m.is_open());
+    assert(m.empty());
+
+    rix::io::MappedFile moved{std::move(m)};
+    assert(moved.is_open());
+    assert(!m.is_open());
+  }
+
+  fs::remove(p);
+
+  bool threw = false;
+  try
+  {
+    (void)rix::io::read_file_mapped(p);
+  }
+  catch (const std::system_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+}
+
+static void test_native_backend()
+{
+  const fs::path p = rix::io::temp_path("rix_io_native");
+
+  {
+    rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native};
+    assert(f.is_open());
+    assert(f.backend() == rix::io::FileBackend::native);
+    f.write(std::string_view("native"));
+    f.flush();
+  }
+
+  {
+    rix::io::File f{p, rix::io::FileMode::append, rix::io::FileType::text, rix::io::FileBackend::native};
+    f.write(std::string_view(" io"));
+  }
+
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::text, rix::io::FileBackend::native};
+    assert(f.read_all_text() == "native io");
+    assert(f.read_all_bytes().size() == 9);
+
+    bool threw = false;
+    try
+    {
+      f.write(std::string_view("x"));
+    }
+    catch (const std::runtime_error &)
+    {
+      threw = true;
+    }
+    assert(threw);
+
+    rix::io::File moved{std::move(f)};
+    assert(moved.is_open());
+    assert(moved.read_all_text() == "native io");
+  }
+
+  fs::remove(p);
+
+  bool threw = false;
+  try
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native};
+  }
+  catch (const std::system_error &e)
+  {
+    threw = (e.code() == std::errc::no_such_file_or_directory);
+  }
+  assert(threw);
+}
+
+static void test_read_all_text_sized_and_unsized()
+{
+  const fs::path p = rix::io::temp_path("rix_io_text_large");
+
+  std::string big;
+  for (int i = 0; i < 2000; ++i)
+  {
+    big.append("line ");
+    big.append(std::to_string(i));
+    big.push_back('\n');
+  }
+
+  rix::io::write_file_text(p, big);
+  assert(rix::io::read_file_text(p) == big);
+
+  rix::io::write_file_text(p, "");
+  assert(rix::io::read_file_text(p).empty());
+
+  fs::remove(p);
+
+#if defined(__linux__)
+  // procfs reports a size of 0 but has content.
+  const auto status = rix::io::read_file_text("/proc/self/status");
+  assert(status.find("Name:") != std::string::npos);
+
+  rix::io::File native{"/proc/self/status", rix::io::FileMode::read, rix::io::FileType::text, rix::io::FileBackend::native};
+  assert(native.read_all_text().find("Name:") != std::string::npos);
+#endif
+}
+
+static void test_read_into_buffer()
+{
+  const fs::path p = rix::io::temp_path("rix_io_into");
+
+  rix::io::write_file_text(p, "first payload");
+
+  rix::io::Buffer b;
+  rix::io::read_file_into(p, b);
+  assert(b.to_string() == "first payload");
+
+  const auto cap = b.bytes().capacity();
+  const auto *before = b.data();
+
+  rix::io::write_file_text(p, "second");
+  rix::io::read_file_into(p, b);
+  assert(b.to_string() == "second");
+  assert(b.bytes().capacity() == cap);
+  assert(b.data() == before);
+
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary};
+    f.read_all_into(b);
+    assert(b.to_string() == "second");
+  }
+
+  fs::remove(p);
+}
+
+static void test_positional_io()
+{
+  const fs::path p = rix::io::temp_path("rix_io_pos");
+
+  rix::io::write_file_text(p, "0123456789");
+
+  {
+    rix::io::File f{p, rix::io::FileMode::read_write, rix::io::FileType::binary, rix::io::FileBackend::native};
+    assert(f.size() == 10);
+
+    std::byte out[4]{};
+    assert(f.read_at(3, out) == 4);
+    assert(out[0] == std::byte{'3'} && out[3] == std::byte{'6'});
+
+    assert(f.read_at(8, out) == 2);
+    assert(f.read_at(20, out) == 0);
+
+    const std::byte patch[2]{std::byte{'x'}, std::byte{'y'}};
+    f.write_at(12, patch);
+    assert(f.size() == 14);
+
+    // Positional I/O does not move the cursor used by read_all_*.
+    const auto all = f.read_all_bytes();
+    assert(all.size() == 14);
+    assert(all[12] == std::byte{'x'});
+  }
+
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary};
+    std::byte out[1]{};
+
+    bool threw = false;
+    try
+    {
+      (void)f.read_at(0, out);
+    }
+    catch (const std::runtime_error &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+
+  fs::remove(p);
+}
+
+static void test_chunk_reader()
+{
+  const fs::path p = rix::io::temp_path("rix_io_chunks");
+
+  std::string content(10000, 'a');
+  for (std::size_t i = 0; i < content.size(); ++i)
+  {
+    content[i] = static_cast<char>('a' + (i % 26));
+  }
+  rix::io::write_file_text(p, content);
+
+  rix::io::ChunkReaderOptions opts;
+  opts.chunk_size = 4096;
+
+  std::string joined;
+  std::size_t chunks = 0;
+  const auto total = rix::io::for_each_chunk(
+      p,
+      [&](std::span<const std::byte> chunk)
+      {
+        assert(chunk.size() <= 4096);
+        joined.append(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+        ++chunks;
+      },
+      opts);
+
+  assert(total == content.size());
+  assert(chunks == 3);
+  assert(joined == content);
+
+  rix::io::ChunkReader reader{p, opts};
+  while (!reader.next().empty())
+  {
+  }
+  assert(reader.eof());
+  assert(reader.next().empty());
+  assert(reader.offset() == content.size());
+
+  fs::remove(p);
+}
+
+static void test_line_reader()
+{
+  const fs::path p = rix::io::temp_path("rix_io_lines");
+
+  const std::string long_line(100, 'z');
+  rix::io::write_file_text(p, "alpha\r\n\nbeta\n" + long_line + "\ngamma");
+
+  rix::io::LineReaderOptions opts;
+  opts.buffer_size = 8;
+
+  rix::io::LineReader reader{p, opts};
+  std::vector<std::string> lines;
+  std::string_view line;
+  while (reader.next(line))
+  {
+    lines.emplace_back(line);
+  }
+
+  assert(lines.size() == 5);
+  assert(lines[0] == "alpha");
+  assert(lines[1].empty());
+  assert(lines[2] == "beta");
+  assert(lines[3] == long_line);
+  assert(lines[4] == "gamma");
+  assert(reader.line_number() == 5);
+  assert(!reader.next(line));
+
+  rix::io::write_file_text(p, "");
+  rix::io::LineReader empty{p};
+  assert(!empty.next(line));
+
+  fs::remove(p);
+}
+
+static void test_buffered_writer()
+{
+  const fs::path p = rix::io::temp_path("rix_io_buffered");
+
+  rix::io::BufferedWriterOptions opts;
+  opts.capacity = 16;
+
+  {
+    rix::io::BufferedWriter w{p, rix::io::WriteMode::truncate, opts};
+    w.write(std::string_view("abc"));
+    w.write(std::string_view("def"));
+    assert(w.buffered() == 6);
+    assert(rix::io::path_size(p) == 0);
+
+    w.write(std::string_view("0123456789"));
+    assert(w.buffered() == 0);
+    assert(rix::io::path_size(p) == 16);
+
+    w.write(std::string_view("x"));
+    w.write(std::string_view("a write larger than capacity"));
+    assert(w.buffered() == 0);
+
+    w.write(std::string_view("!"));
+    w.flush();
+    assert(w.buffered() == 0);
+  }
+
+  assert(rix::io::read_file_text(p) == "abcdef0123456789xa write larger than capacity!");
+
+  {
+    rix::io::BufferedWriter w{p, rix::io::WriteMode::append, opts};
+    w.write(std::string_view("tail"));
+  }
+
+  assert(rix::io::read_file_text(p) == "abcdef0123456789xa write larger than capacity!tail");
+
+  fs::remove(p);
+}
+
+static void test_vectored_io()
+{
+  const fs::path p = rix::io::temp_path("rix_io_vec");
+
+  const std::string head = "HEAD|";
+  const std::string body = "body";
+  const std::string tail = "|TAIL";
+
+  const auto as_bytes = [](const std::string &s)
+  {
+    return std::span<const std::byte>(reinterpret_cast<const std::byte *>(s.data()), s.size());
+  };
+
+  const std::span<const std::byte> parts[] = {as_bytes(head), {}, as_bytes(body), as_bytes(tail)};
+
+  for (const auto backend : {rix::io::FileBackend::native, rix::io::FileBackend::stream})
+  {
+    {
+      rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, backend};
+      f.write(std::span<const std::span<const std::byte>>(parts));
+    }
+    assert(rix::io::read_file_text(p) == "HEAD|body|TAIL");
+
+    std::byte a[5]{};
+    std::byte b[20]{};
+    const std::span<std::byte> out[] = {a, b};
+
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary, backend};
+    assert(f.read(std::span<const std::span<std::byte>>(out)) == 14);
+    assert(a[0] == std::byte{'H'} && a[4] == std::byte{'|'});
+    assert(b[0] == std::byte{'b'} && b[8] == std::byte{'L'});
+  }
+
+  fs::remove(p);
+}
+
+static void test_path_copy()
+{
+  const fs::path src = rix::io::temp_path("rix_io_copy_src");
+  const fs::path dst = rix::io::temp_path("rix_io_copy_dst");
+
+  std::string content(300000, '\0');
+  for (std::size_t i = 0; i < content.size(); ++i)
+  {
+    content[i] = static_cast<char>(i * 31u);
+  }
+  rix::io::write_file_text(src, content);
+
+  assert(rix::io::path_copy(src, dst) == content.size());
+  assert(rix::io::read_file_text(dst) == content);
+
+  rix::io::write_file_text(src, "short");
+  assert(rix::io::path_copy(src, dst) == 5);
+  assert(rix::io::read_file_text(dst) == "short");
+
+  rix::io::PathCopyOptions no_overwrite;
+  no_overwrite.overwrite = false;
+
+  bool threw = false;
+  try
+  {
+    (void)rix::io::path_copy(src, dst, no_overwrite);
+  }
+  catch (const fs::filesystem_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try
+  {
+    (void)rix::io::path_copy(src, src);
+  }
+  catch (const fs::filesystem_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+  assert(rix::io::read_file_text(src) == "short");
+
+#if defined(__linux__)
+  assert(rix::io::path_copy("/proc/self/status", dst) > 0);
+  assert(rix::io::read_file_text(dst).find("Name:") != std::string::npos);
+#endif
+
+  fs::remove(src);
+  fs::remove(dst);
+}
+
+namespace
+{
+  struct DetachedCoroutine
+  {
+    struct promise_type
+    {
+      DetachedCoroutine get_return_object() noexcept { return {}; }
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_never final_suspend() noexcept { return {}; }
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+    };
+  };
+
+  DetachedCoroutine read_with_co_await(rix::io::AsyncIoContext &ctx,
+                                       rix::io::File &file,
+                                       std::span<std::byte> out,
+                                       std::atomic<std::size_t> &result)
+  {
+    const std::size_t n = co_await ctx.read_at(file, 2, out);
+    result.store(n + 1);
+  }
+} // namespace
+
+static void test_async_io_context()
+{
+  const fs::path p = rix::io::temp_path("rix_io_async");
+
+  for (const auto backend : {rix::io::AsyncBackend::automatic, rix::io::AsyncBackend::thread_pool})
+  {
+    rix::io::AsyncIoOptions opts;
+    opts.backend = backend;
+    opts.queue_depth = 4;
+    opts.threads = 2;
+
+    rix::io::AsyncIoContext ctx{opts};
+    assert(ctx.backend() != rix::io::AsyncBackend::automatic);
+
+    {
+      rix::io::File out{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native};
+      const std::string text = "async engine payload";
+
+      auto batch = ctx.batch();
+      auto w1 = batch.write_at(out, 0, std::span<const std::byte>(reinterpret_cast<const std::byte *>(text.data()), 6));
+      auto w2 = batch.write_at(out, 6, std::span<const std::byte>(reinterpret_cast<const std::byte *>(text.data()) + 6, text.size() - 6));
+      batch.submit();
+      const std::size_t n1 = w1.get();
+      const std::size_t n2 = w2.get();
+      assert(n1 == 6);
+      assert(n2 == text.size() - 6);
+    }
+
+    rix::io::File in{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native};
+
+    // More operations than queue slots.
+    std::vector<std::array<std::byte, 4>> bufs(16);
+    std::vector<rix::io::IoFuture> futures;
+    {
+      auto batch = ctx.batch();
+      for (std::size_t i = 0; i < bufs.size(); ++i)
+      {
+        futures.push_back(batch.read_at(in, i, bufs[i]));
+      }
+    }
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+      const std::size_t n = futures[i].get();
+      assert(n == 4);
+      assert(bufs[i][0] == static_cast<std::byte>("async engine payload"[i]));
+    }
+
+    std::array<std::byte, 64> big{};
+    const std::size_t whole = ctx.read_at(in, 0, big).get();
+    const std::size_t past_end = ctx.read_at(in, 100, big).get();
+    assert(whole == 20);
+    assert(past_end == 0);
+
+    std::atomic<std::size_t> result{0};
+    read_with_co_await(ctx, in, big, result);
+    while (result.load() == 0)
+    {
+      std::this_thread::yield();
+    }
+    assert(result.load() == 19);
+
+    bool threw = false;
+    try
+    {
+      rix::io::File stream_file{p, rix::io::FileMode::read, rix::io::FileType::binary};
+      (void)ctx.read_at(stream_file, 0, big);
+    }
+    catch (const std::invalid_argument &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+
+  fs::remove(p);
+}
+
+namespace
+{
+  template <class Context>
+  rix::io::Task<std::string> write_then_read(Context &ctx, const fs::path &p)
+  {
+    co_await rix::io::async_write_file_text(ctx, p, "co_await ");
+    co_await rix::io::async_write_file_text(ctx, p, "rix::io", rix::io::WriteMode::append);
+    const auto bytes = co_await rix::io::async_read_file_binary(ctx, p);
+    assert(bytes.size() == 16);
+    co_return co_await rix::io::async_read_file_text(ctx, p);
+  }
+} // namespace
+
+static void test_async_file_helpers()
+{
+  const fs::path p = rix::io::temp_path("rix_io_async_file");
+
+  {
+    rix::io::AsyncIoContext ctx;
+    const auto round_trip = rix::io::sync_wait(write_then_read(ctx, p));
+    assert(round_trip == "co_await rix::io");
+
+    std::string large(200000, 'q');
+    rix::io::write_file_text(p, large);
+    const auto large_back = rix::io::sync_wait(rix::io::async_read_file_text(ctx, p));
+    assert(large_back == large);
+
+    // Exactly one probe past the hint, including for empty files.
+    for (const std::size_t n : {std::size_t{0}, std::size_t{4096}, std::size_t{65536}})
+    {
+      rix::io::write_file_text(p, std::string(n, 'e'));
+      const auto exact = rix::io::sync_wait(rix::io::async_read_file_binary(ctx, p));
+      assert(exact.size() == n);
+    }
+
+#if defined(__linux__)
+    const auto status = rix::io::sync_wait(rix::io::async_read_file_text(ctx, "/proc/self/status"));
+    assert(status.find("Name:") != std::string::npos);
+#endif
+  }
+
+  {
+    rix::io::ThreadPool pool{2};
+    const auto pooled = rix::io::sync_wait(write_then_read(pool, p));
+    assert(pooled == "co_await rix::io");
+  }
+
+  fs::remove(p);
+
+  rix::io::AsyncIoContext ctx;
+  bool threw = false;
+  try
+  {
+    (void)rix::io::sync_wait(rix::io::async_read_file_binary(ctx, p));
+  }
+  catch (const std::system_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+}
+
+static void test_read_files_binary()
+{
+  std::vector<fs::path> paths;
+  for (int i = 0; i < 17; ++i)
+  {
+    paths.push_back(rix::io::temp_path("rix_io_batch"));
+    const std::string content(static_cast<std::size_t>(i) * 97, static_cast<char>('a' + i));
+    rix::io::write_file_text(paths.back(), content);
+  }
+  paths.insert(paths.begin() + 5, rix::io::temp_path("rix_io_batch_missing"));
+
+  auto check = [&paths](const std::vector<rix::io::FileReadResult> &results)
+  {
+    assert(results.size() == paths.size());
+    for (std::size_t i = 0, file = 0; i < results.size(); ++i)
+    {
+      if (i == 5)
+      {
+        assert(!results[i]);
+        assert(results[i].error == std::errc::no_such_file_or_directory);
+        continue;
+      }
+      assert(results[i].ok());
+      assert(results[i].bytes.size() == file * 97);
+      assert(results[i].bytes.empty() || results[i].bytes.back() == static_cast<std::byte>('a' + file));
+      ++file;
+    }
+  };
+
+  check(rix::io::read_files_binary(paths));
+  check(rix::io::read_files_binary(paths, {.threads = 1}));
+  check(rix::io::read_files_binary(paths, {.threads = 4}));
+
+  rix::io::ThreadPool pool{3};
+  check(rix::io::read_files_binary(pool, paths));
+  assert(rix::io::read_files_binary(pool, std::span<const fs::path>{}).empty());
+
+  for (const auto &p : paths)
+  {
+    fs::remove(p);
+  }
+}
+
+static void test_allocator_aware_buffers()
+{
+  const fs::path p = rix::io::temp_path("rix_io_pmr");
+  const std::string content(5000, 'm');
+  rix::io::write_file_text(p, content);
+
+  {
+    std::array<std::byte, 16 * 1024> arena{};
+    std::pmr::monotonic_buffer_resource resource{arena.data(), arena.size(), std::pmr::null_memory_resource()};
+
+    rix::io::pmr::Buffer b{&resource};
+    rix::io::read_file_into(p, b);
+    assert(b.as_string_view() == content);
+    assert(b.data() >= arena.data() && b.data() < arena.data() + arena.size());
+    assert(b.get_allocator().resource() == &resource);
+
+    b.reset();
+    assert(b.empty());
+    assert(b.get_allocator().resource() == &resource);
+  }
+
+  {
+    rix::io::BufferPool pool{{.buffer_capacity = 8192, .max_cached = 2}};
+    const std::byte *first = nullptr;
+    {
+      auto lease = pool.acquire();
+      assert(lease->empty());
+      assert(lease->capacity() >= 8192);
+      rix::io::read_file_into(p, *lease);
+      assert(lease->as_string_view() == content);
+      first = lease->data();
+    }
+    assert(pool.cached() == 1);
+
+    {
+      auto lease = pool.acquire();
+      assert(pool.cached() == 0);
+      assert(lease->empty());
+      assert(lease->data() == first);
+
+      auto other = std::move(lease);
+      assert(other->data() == first);
+    }
+    assert(pool.cached() == 1);
+
+    {
+      auto a = pool.acquire();
+      auto b = pool.acquire();
+      auto c = pool.acquire();
+      c->reset();
+      rix::io::Buffer kept = pool.acquire().release();
+      (void)kept;
+    }
+    assert(pool.cached() == 2);
+  }
+
+  fs::remove(p);
+}
+
+static void test_uninitialized_buffer()
+{
+  const fs::path p = rix::io::temp_path("rix_io_uninit");
+  const std::string content(70000, 'u');
+  rix::io::write_file_text(p, content);
+
+  rix::io::UninitializedBuffer b;
+  rix::io::read_file_into(p, b);
+  assert(b.as_string_view() == content);
+
+  b.resize_uninitialized(16);
+  assert(b.size() == 16);
+  assert(b[15] == static_cast<std::byte>('u'));
+
+  b.clear();
+  b.append_pod(std::uint32_t{0x01020304u});
+  b.append("xy");
+  assert(b.size() == 6);
+  assert(b.read_pod<std::uint32_t>(0) == 0x01020304u);
+  assert(b.as_string_view().substr(4) == "xy");
+
+  rix::io::Buffer z;
+  z.resize_uninitialized(4);
+  assert(z[3] == std::byte{0});
+
+  fs::remove(p);
+}
+
+static void test_buffer_reader()
+{
+  rix::io::Buffer b;
+  b.append_pod(std::uint32_t{7});
+  b.append_pod(std::uint16_t{0xBEEF});
+  b.append("hdr");
+  const std::array<std::int32_t, 4> values{-1, 2, -3, 4};
+  for (const auto v : values)
+  {
+    b.append_pod(v);
+  }
+  b.append_byte(0x42);
+
+  rix::io::BufferReader r{b.span()};
+  assert(r.size() == b.size());
+  assert(r.read<std::uint32_t>() == 7u);
+  assert(r.read<std::uint16_t>() == 0xBEEF);
+
+  const auto hdr = r.read_span(3);
+  assert(std::string_view(reinterpret_cast<const char *>(hdr.data()), hdr.size()) == "hdr");
+
+  const auto arr = r.read_array<std::int32_t>(4);
+  assert(arr.size() == 4 && arr[0] == -1 && arr[3] == 4);
+
+  assert(r.remaining() == 1);
+  assert(!r.try_read<std::uint32_t>().has_value());
+  assert(r.remaining() == 1);
+
+  bool threw = false;
+  try
+  {
+    (void)r.read<std::uint64_t>();
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+  assert(r.position() == b.size() - 1);
+
+  assert(r.try_read<std::uint8_t>() == std::uint8_t{0x42});
+  assert(r.eof());
+
+  r.seek(6);
+  r.skip(3);
+  std::array<std::int32_t, 2> two{};
+  r.read_array(std::span<std::int32_t>(two));
+  assert(two[0] == -1 && two[1] == 2);
+
+  threw = false;
+  try
+  {
+    (void)r.read_array<std::int32_t>(3);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+  assert(r.remaining() == 9);
+}
+
+static void test_endian_encoding()
+{
+  static_assert(rix::io::byte_swap(std::uint32_t{0x11223344u}) == 0x44332211u);
+  static_assert(rix::io::byte_swap(std::int16_t{0x0102}) == 0x0201);
+
+  rix::io::Buffer b;
+  b.append_be(std::uint32_t{0x01020304u});
+  b.append_le(std::uint32_t{0x01020304u});
+  b.append_be(std::uint16_t{0xA1B2});
+  b.append_le(1.5);
+
+  assert(b.size() == 18);
+  assert(b[0] == std::byte{0x01} && b[3] == std::byte{0x04});
+  assert(b[4] == std::byte{0x04} && b[7] == std::byte{0x01});
+  assert(b[8] == std::byte{0xA1} && b[9] == std::byte{0xB2});
+  assert(b.read_be<std::uint32_t>(0) == 0x01020304u);
+  assert(b.read_le<std::uint32_t>(4) == 0x01020304u);
+  assert(b.read_le<double>(10) == 1.5);
+
+  b.write_be(8, std::uint16_t{0x0A0B});
+  assert(b[8] == std::byte{0x0A} && b.read_be<std::uint16_t>(8) == 0x0A0B);
+
+  std::vector<std::uint32_t> values(37);
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = static_cast<std::uint32_t>(i * 0x01010101u);
+  }
+
+  rix::io::Buffer be;
+  be.append_array_be(std::span<const std::uint32_t>(values));
+  rix::io::Buffer le;
+  le.append_array_le(std::span<const std::uint32_t>(values));
+  assert(be.size() == values.size() * 4 && le.size() == be.size());
+
+  rix::io::BufferReader rb{be.span()};
+  rix::io::BufferReader rl{le.span()};
+  for (const auto v : values)
+  {
+    assert(rb.read_be<std::uint32_t>() == v);
+    assert(rl.read_le<std::uint32_t>() == v);
+  }
+
+  std::vector<std::uint32_t> decoded(values.size());
+  rb.seek(0);
+  rb.read_array_be(std::span<std::uint32_t>(decoded));
+  assert(decoded == values);
+
+  rix::io::byte_swap_inplace(std::span<std::uint32_t>(decoded));
+  assert(decoded[1] == rix::io::byte_swap(values[1]));
+}
+
+static void test_varint_encoding()
+{
+  static_assert(rix::io::varint_size(0) == 1);
+  static_assert(rix::io::varint_size(127) == 1);
+  static_assert(rix::io::varint_size(128) == 2);
+  static_assert(rix::io::varint_size(~std::uint64_t{0}) == rix::io::max_varint_size);
+  static_assert(rix::io::zigzag_encode(-1) == 1 && rix::io::zigzag_decode(1) == -1);
+
+  const std::array<std::uint64_t, 10> values{0, 1, 127, 128, 300, 16383, 16384,
+                                             (std::uint64_t{1} << 56) - 1, std::uint64_t{1} << 56,
+                                             ~std::uint64_t{0}};
+
+  rix::io::Buffer b;
+  b.append_varint(300);
+  assert(b.size() == 2 && b[0] == std::byte{0xAC} && b[1] == std::byte{0x02});
+
+  b.clear();
+  for (const auto v : values)
+  {
+    b.append_varint(v);
+  }
+  b.append_varint_signed(-123456789);
+  b.append_length_prefixed("payload");
+  b.append_length_prefixed(std::string_view{});
+
+  rix::io::BufferReader r{b.span()};
+  for (const auto v : values)
+  {
+    assert(r.read_varint() == v);
+  }
+  assert(r.read_varint_signed() == -123456789);
+  assert(r.read_length_prefixed_text() == "payload");
+  assert(r.read_length_prefixed().empty());
+  assert(r.eof());
+  assert(!r.try_read_varint().has_value());
+
+  // Every value is also decoded from the tail, where the bulk path cannot load 8 bytes.
+  for (const auto v : values)
+  {
+    rix::io::Buffer one;
+    one.append_varint(v);
+    rix::io::BufferReader tail{one.span()};
+    assert(tail.try_read_varint() == v);
+  }
+
+  const std::array<std::byte, 3> truncated{std::byte{0x80}, std::byte{0x80}, std::byte{0x80}};
+  rix::io::BufferReader bad{truncated};
+  assert(!bad.try_read_varint().has_value());
+  assert(bad.position() == 0);
+
+  std::array<std::byte, 11> overflow{};
+  overflow.fill(std::byte{0xFF});
+  overflow[10] = std::byte{0x01};
+  rix::io::BufferReader over{overflow};
+  assert(!over.try_read_varint().has_value());
+
+  rix::io::Buffer lying;
+  lying.append_varint(50);
+  lying.append("short");
+  rix::io::BufferReader lr{lying.span()};
+  bool threw = false;
+  try
+  {
+    (void)lr.read_length_prefixed();
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw && lr.position() == 0);
+}
+
+template <class Buf>
+static void serialize_record(Buf &out)
+{
+  const std::uint32_t words[] = {0x01020304u, 0xa0b0c0d0u};
+  out.append_le(std::uint16_t{0x1234});
+  out.append_be(std::uint32_t{0xdeadbeefu});
+  out.append_array_le(std::span<const std::uint32_t>(words));
+  out.append_array_be(std::span<const std::uint32_t>(words));
+  out.append_varint_signed(-3);
+  out.append_length_prefixed(std::string_view{"name"});
+  out.append_length_prefixed(std::as_bytes(std::span<const std::uint32_t>(words)));
+  out.write_be(0, std::uint16_t{0x1234});
+}
+
+static void test_inline_buffer()
+{
+  rix::io::InlineBuffer<16> b;
+  assert(b.is_inline() && b.capacity() == 16);
+
+  b.append("key:");
+  b.append_pod(std::uint32_t{42});
+  b.append_be(std::uint16_t{0x0102});
+  b.append_varint(300);
+  assert(b.is_inline());
+  assert(b.size() == 12);
+  assert(b.read_pod<std::uint32_t>(4) == 42u);
+  assert(b[8] == std::byte{0x01});
+
+  rix::io::InlineBuffer<16> copy{b};
+  assert(copy.as_string_view() == b.as_string_view());
+
+  b.append(b.span());
+  assert(!b.is_inline());
+  assert(b.size() == 24);
+  assert(b.as_string_view().substr(12) == copy.as_string_view());
+
+  rix::io::InlineBuffer<16> moved{std::move(b)};
+  assert(moved.size() == 24 && !moved.is_inline());
+  assert(b.empty() && b.is_inline());
+
+  rix::io::InlineBuffer<16> small{std::move(copy)};
+  assert(small.is_inline() && small.size() == 12);
+  assert(small.read_pod<std::uint32_t>(4) == 42u);
+
+  small = moved;
+  assert(small.as_string_view() == moved.as_string_view());
+
+  moved.resize(30);
+  assert(moved[29] == std::byte{0});
+
+  moved.reset();
+  assert(moved.empty() && moved.is_inline() && moved.capacity() == 16);
+
+  rix::io::BufferReader r{small.span()};
+  r.skip(8);
+  assert(r.read_be<std::uint16_t>() == 0x0102);
+  assert(r.read_varint() == 300);
+
+  rix::io::Buffer ref;
+  rix::io::InlineBuffer<8> rec;
+  serialize_record(ref);
+  serialize_record(rec);
+  assert(rec.as_string_view() == ref.as_string_view());
+  assert(rec.read_be<std::uint16_t>(0) == 0x1234);
+  assert(rec.read_be<std::uint32_t>(2) == 0xdeadbeefu);
+  assert(rec.read_le<std::uint32_t>(6) == 0x01020304u);
+  assert(rec.read_be<std::uint32_t>(14) == 0x01020304u);
+  rec.write_le(2, std::uint32_t{7});
+  assert(rec.read_le<std::uint32_t>(2) == 7u);
+
+  // Length-prefixing a view of the buffer itself must survive the move to the heap.
+  rix::io::InlineBuffer<8> self{std::string_view{"abcdefgh"}};
+  self.append_length_prefixed(self.span());
+  assert(self.as_string_view() == std::string_view{"abcdefgh\x08" "abcdefgh"});
+
+  bool threw = false;
+  try
+  {
+    (void)rec.read_le<std::uint64_t>(rec.size() - 4);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+}
+
+static void test_buffer_chain()
+{
+  rix::io::BufferChain chain{{.segment_size = 8}};
+  chain.append("hello");
+  chain.append(" world");
+  assert(chain.size() == 11);
+  assert(chain.segment_count() == 2);
+
+  chain.append(rix::io::Buffer{std::string_view{"!!"}});
+  chain.prepend("> ");
+  auto shared = std::make_shared<const rix::io::Buffer>(std::string_view{"[tag]"});
+  chain.prepend(shared);
+  assert(chain.flatten().as_string_view() == "[tag]> hello world!!");
+
+  const auto copy = chain;
+  chain.append("?");
+  assert(copy.flatten().as_string_view() == "[tag]> hello world!!");
+  assert(chain.flatten().as_string_view() == "[tag]> hello world!!?");
+
+  const auto mid = chain.slice(7, 11);
+  assert(mid.flatten().as_string_view() == "hello world");
+  assert(chain.slice(0, 0).empty());
+
+  bool threw = false;
+  try
+  {
+    (void)chain.slice(20, 5);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  chain.remove_prefix(7);
+  assert(chain.flatten().as_string_view() == "hello world!!?");
+
+  chain.append(mid);
+  assert(chain.flatten().as_string_view() == "hello world!!?hello world");
+
+  const fs::path p = rix::io::temp_path("rix_io_chain");
+  {
+    rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native};
+    chain.write_to(f);
+  }
+  assert(rix::io::read_file_text(p) == "hello world!!?hello world");
+  fs::remove(p);
+}
+
+static void test_atomic_replace()
+{
+  const fs::path dir = rix::io::temp_path("rix_io_atomic_dir");
+  fs::create_directories(dir);
+  const fs::path p = dir / "state.cfg";
+
+  rix::io::write_file_text(p, "v1", rix::io::WriteMode::atomic_replace);
+  assert(rix::io::read_file_text(p) == "v1");
+
+  fs::permissions(p, fs::perms::owner_read | fs::perms::owner_write);
+  rix::io::write_file_atomic(p, std::string_view{"v2"}, {.durable = false});
+  assert(rix::io::read_file_text(p) == "v2");
+  assert((fs::status(p).permissions() & fs::perms::all) == (fs::perms::owner_read | fs::perms::owner_write));
+
+  const std::array<std::byte, 3> bytes{std::byte{1}, std::byte{2}, std::byte{3}};
+  rix::io::write_file_binary(p, bytes, rix::io::WriteMode::atomic_replace);
+  assert(rix::io::read_file_binary(p).size() == 3);
+
+  {
+    rix::io::File f{p, rix::io::FileMode::append, rix::io::FileType::binary, rix::io::FileBackend::native};
+    f.write(std::string_view{"+"});
+    f.sync();
+    f.sync_data();
+  }
+  assert(rix::io::path_size(p) == 4);
+
+  bool threw = false;
+  try
+  {
+    rix::io::BufferedWriter w{p, rix::io::WriteMode::atomic_replace};
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+  assert(rix::io::path_size(p) == 4);
+
+  {
+    rix::io::GroupCommit group{{.window = std::chrono::milliseconds(2), .max_batch = 4}};
+    std::vector<std::thread> writers;
+    for (int i = 0; i < 6; ++i)
+    {
+      writers.emplace_back([&group, &dir, i]
+                           {
+                             const std::string content = "writer " + std::to_string(i);
+                             rix::io::write_file_atomic(dir / ("w" + std::to_string(i)), std::string_view{content},
+                                                        {.group = &group}); });
+    }
+    for (auto &t : writers)
+    {
+      t.join();
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+      assert(rix::io::read_file_text(dir / ("w" + std::to_string(i))) == "writer " + std::to_string(i));
+    }
+  }
+
+  {
+    rix::io::AsyncIoContext ctx;
+    rix::io::sync_wait(rix::io::async_write_file_text(ctx, p, "async", rix::io::WriteMode::atomic_replace));
+    assert(rix::io::read_file_text(p) == "async");
+  }
+
+  std::size_t entries = 0;
+  for (const auto &e : fs::directory_iterator(dir))
+  {
+    (void)e;
+    ++entries;
+  }
+  assert(entries == 7);
+
+  // A name already taken by a symlink is skipped, never written through.
+  {
+    const fs::path victim = dir / "victim";
+    rix::io::write_file_text(victim, "untouched");
+    const fs::path planted = dir / ".state.cfg.planted";
+    fs::create_symlink(victim, planted);
+
+    const std::array<fs::path, 2> names{planted, rix::io::detail::atomic_sibling(p)};
+    std::size_t next = 0;
+    fs::path claimed;
+    {
+      rix::io::File f = rix::io::detail::create_new_file([&]
+                                                         { return names[next++]; },
+                                                         rix::io::FileMode::write, rix::io::FileType::binary);
+      claimed = f.path();
+    }
+    assert(next == 2 && claimed == names[1]);
+    assert(fs::is_symlink(planted) && rix::io::read_file_text(victim) == "untouched");
+    fs::remove(claimed);
+
+    rix::io::write_file_atomic(p, std::string_view{"v3"});
+    assert(rix::io::read_file_text(p) == "v3" && !fs::is_symlink(p));
+    assert(rix::io::read_file_text(victim) == "untouched");
+  }
+
+  fs::remove_all(dir);
+}
+
+static void test_direct_io()
+{
+  rix::io::AlignedBuffer<> buf;
+  buf.resize(2 * rix::io::direct_io_alignment);
+  assert(reinterpret_cast<std::uintptr_t>(buf.data()) % rix::io::direct_io_alignment == 0);
+  for (std::size_t i = 0; i < buf.size(); ++i)
+  {
+    buf[i] = static_cast<std::byte>(i % 251);
+  }
+
+  const fs::path p = rix::io::temp_path("rix_io_direct");
+
+  bool threw = false;
+  try
+  {
+    rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::stream,
+                    rix::io::FileFlags::direct};
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  try
+  {
+    {
+      rix::io::File w{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native,
+                      rix::io::FileFlags::direct};
+      assert(rix::io::has_flag(w.flags(), rix::io::FileFlags::direct));
+      w.write_at(0, buf.span());
+    }
+
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native,
+                    rix::io::FileFlags::direct};
+
+    rix::io::AlignedBuffer<> back;
+    back.resize(buf.size());
+    const std::size_t n = f.read_at(0, back.span());
+    assert(n == buf.size());
+    assert(std::memcmp(back.data(), buf.data(), buf.size()) == 0);
+
+    bool whole_threw = false;
+    try
+    {
+      (void)f.read_all_bytes();
+    }
+    catch (const std::invalid_argument &)
+    {
+      whole_threw = true;
+    }
+    assert(whole_threw);
+
+    rix::io::AsyncIoContext ctx;
+    rix::io::AlignedBuffer<> async_back;
+    async_back.resize(rix::io::direct_io_alignment);
+    const std::size_t async_n = ctx.read_at(f, rix::io::direct_io_alignment, async_back.span()).get();
+    assert(async_n == async_back.size());
+    assert(std::memcmp(async_back.data(), buf.data() + rix::io::direct_io_alignment, async_back.size()) == 0);
+  }
+  catch (const std::system_error &e)
+  {
+    // Some filesystems (e.g. tmpfs on older kernels) reject O_DIRECT.
+    assert(e.code() == std::errc::invalid_argument || e.code() == std::errc::not_supported);
+  }
+
+  fs::remove(p);
+}
+
+static void test_preallocate_and_punch_hole()
+{
+  const fs::path p = rix::io::temp_path("rix_io_falloc");
+  bool punched = false;
+
+  {
+    rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native};
+    const bool reserved = f.preallocate(1 << 20);
+    assert(f.size() == 0);
+
+    const std::string block(3 * 4096, 'x');
+    f.write(block);
+    assert(f.size() == block.size());
+
+    punched = f.punch_hole(4096, 4096);
+    assert(f.size() == block.size());
+    (void)reserved;
+  }
+
+  const auto content = rix::io::read_file_binary(p);
+  assert(content.size() == 3 * 4096);
+  assert(content[0] == static_cast<std::byte>('x'));
+  assert(content.back() == static_cast<std::byte>('x'));
+  if (punched)
+  {
+    assert(content[4096] == std::byte{0} && content[2 * 4096 - 1] == std::byte{0});
+  }
+
+  {
+    rix::io::BufferedWriter w{p, rix::io::WriteMode::append, {.capacity = 1024, .size_hint = 1 << 20}};
+    w.write(std::string_view{"tail"});
+  }
+  assert(rix::io::path_size(p) == 3 * 4096 + 4);
+
+  const std::vector<std::byte> big(2 << 20, std::byte{7});
+  rix::io::write_file_binary(p, big);
+  assert(rix::io::path_size(p) == big.size());
+
+  bool threw = false;
+  try
+  {
+    rix::io::File r{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native};
+    (void)r.preallocate(10);
+  }
+  catch (const std::runtime_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  fs::remove(p);
+}
+
+static void test_access_hints()
+{
+  const fs::path p = rix::io::temp_path("rix_io_advise");
+  const std::string payload(64 * 1024, 'h');
+  rix::io::write_file_text(p, payload);
+
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native};
+    const bool seq = f.advise(rix::io::AccessPattern::sequential);
+    const bool pre = f.prefetch(0, payload.size());
+    (void)f.advise(rix::io::AccessPattern::huge_pages);
+#if defined(__linux__)
+    assert(seq && pre);
+#endif
+    (void)seq;
+    (void)pre;
+    assert(f.read_all_text() == payload);
+  }
+
+  {
+    rix::io::MappedFile m{p};
+    const bool rnd = m.advise(rix::io::AccessPattern::random, 100, 10);
+    const bool pre = m.prefetch();
+    (void)m.advise(rix::io::AccessPattern::huge_pages);
+    (void)m.advise(rix::io::AccessPattern::dont_need, 4096);
+#if !defined(_WIN32)
+    assert(rnd && pre);
+#endif
+    (void)rnd;
+    (void)pre;
+    assert(m.as_string_view() == payload);
+
+    bool threw = false;
+    try
+    {
+      (void)m.advise(rix::io::AccessPattern::normal, payload.size() + 1);
+    }
+    catch (const std::invalid_argument &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+
+  bool threw = false;
+  try
+  {
+    rix::io::File s{p, rix::io::FileMode::read};
+    (void)s.advise(rix::io::AccessPattern::sequential);
+  }
+  catch (const std::runtime_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  fs::remove(p);
+}
+
+static void test_file_cache()
+{
+  const fs::path a = rix::io::temp_path("rix_io_cache_a");
+  const fs::path b = rix::io::temp_path("rix_io_cache_b");
+  rix::io::write_file_text(a, "first");
+  rix::io::write_file_text(b, std::string(600, 'b'));
+
+  rix::io::FileCache cache{{.max_bytes = 1024, .shards = 1}};
+  const auto first = cache.get(a);
+  assert(first->as_string_view() == "first");
+  assert(cache.get(a) == first);
+  assert(cache.stats().hits == 1 && cache.stats().misses == 1);
+
+  rix::io::write_file_text(a, "second!");
+  const auto second = cache.get(a);
+  assert(second != first && second->as_string_view() == "second!");
+  assert(first->as_string_view() == "first");
+
+  // 7 + 600 bytes fit the budget; growing b past it evicts the older entry.
+  (void)cache.get(b);
+  assert(cache.stats().entries == 2 && cache.stats().bytes == 607);
+  rix::io::write_file_text(b, std::string(1020, 'c'));
+  (void)cache.get(b);
+  assert(cache.stats().entries == 1 && cache.stats().bytes == 1020);
+
+  rix::io::write_file_text(b, std::string(2000, 'd'));
+  assert(cache.get(b)->size() == 2000);
+  assert(cache.stats().entries == 0);
+
+  cache.invalidate(a);
+  cache.clear();
+  assert(cache.stats().bytes == 0);
+
+  bool threw = false;
+  try
+  {
+    (void)cache.get(a.string() + "_missing");
+  }
+  catch (const std::system_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  rix::io::FileCache shared{};
+  std::vector<std::thread> threads;
+  std::atomic<int> mismatches{0};
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&]
+                         {
+                           for (int i = 0; i < 200; ++i)
+                           {
+                             if (shared.get(i % 2 == 0 ? a : b)->empty())
+                             {
+                               ++mismatches;
+                             }
+                           } });
+  }
+  for (auto &th : threads)
+  {
+    th.join();
+  }
+  assert(mismatches == 0);
+  assert(shared.stats().hits + shared.stats().misses == 800);
+
+  fs::remove(a);
+  fs::remove(b);
+}
+
+static void test_hashing()
+{
+  const auto bytes_of = [](std::string_view s)
+  { return std::as_bytes(std::span<const char>(s.data(), s.size())); };
+
+  assert(rix::io::crc32c(bytes_of("")) == 0);
+  assert(rix::io::crc32c(bytes_of("123456789")) == 0xE3069283u);
+  assert(rix::io::xxh64(bytes_of("")) == 0xEF46DB3751D8E999ull);
+  assert(rix::io::xxh64(bytes_of("abc")) == 0x44BC2CF5AD770999ull);
+  assert(rix::io::xxh64(bytes_of("Nobody inspects the spammish repetition")) == 0xFBCEA83C8A378BF1ull);
+
+  std::string payload;
+  for (int i = 0; i < 5000; ++i)
+  {
+    payload.push_back(static_cast<char>((i * 131) ^ (i >> 3)));
+  }
+  const auto data = bytes_of(payload);
+
+  // The hardware path, when picked, must agree with the portable table.
+  for (const std::size_t n : {std::size_t{0}, std::size_t{7}, std::size_t{8}, std::size_t{4999}})
+  {
+    const auto part = data.first(n);
+    assert(rix::io::detail::crc32c_raw(~0u, part) == rix::io::detail::crc32c_table(~0u, part));
+  }
+
+  for (const auto algo : {rix::io::HashAlgorithm::crc32c, rix::io::HashAlgorithm::xxh64})
+  {
+    const std::uint64_t whole = rix::io::hash_bytes(data, algo);
+
+    // Odd split sizes cross the 8-byte and 32-byte block boundaries.
+    rix::io::Hasher h{algo};
+    std::size_t off = 0;
+    for (std::size_t step = 1; off < data.size(); step = step * 3 % 61 + 1)
+    {
+      const std::size_t n = std::min(step, data.size() - off);
+      h.update(data.subspan(off, n));
+      off += n;
+    }
+    assert(h.digest() == whole);
+
+    const fs::path p = rix::io::temp_path("rix_io_hash");
+    {
+      rix::io::BufferedWriter w{p, rix::io::WriteMode::truncate, {.capacity = 256}};
+      rix::io::HashingWriter hw{w, algo};
+      hw.write(data.first(100));
+      hw.write(std::string_view{payload}.substr(100));
+      assert(hw.digest() == whole);
+    }
+
+    assert(rix::io::hash_file(p, algo, {.chunk_size = 999}) == whole);
+
+    rix::io::ChunkReader reader{p, {.chunk_size = 1000}};
+    rix::io::HashingChunkReader hr{reader, algo};
+    while (!hr.next().empty())
+    {
+    }
+    assert(hr.digest() == whole);
+
+    fs::remove(p);
+  }
+}
+
+static void test_compression()
+{
+  const fs::path p = rix::io::temp_path("rix_io_compressed");
+
+  std::string payload;
+  for (int i = 0; i < 100000; ++i)
+  {
+    payload += "line " + std::to_string(i % 97) + "\n";
+  }
+  const auto data = std::as_bytes(std::span<const char>(payload.data(), payload.size()));
+
+  for (const auto codec : {rix::io::Compression::zstd, rix::io::Compression::lz4})
+  {
+    if (!rix::io::compression_available(codec))
+    {
+      bool threw = false;
+      try
+      {
+        rix::io::CompressedWriter w{p, {.codec = codec}};
+      }
+      catch (const std::invalid_argument &)
+      {
+        threw = true;
+      }
+      assert(threw);
+      continue;
+    }
+
+    {
+      rix::io::CompressedWriter w{p, {.codec = codec, .threads = 2, .block_size = 4096}};
+      w.write(data.first(10));
+      w.write(data.subspan(10));
+      w.close();
+      assert(w.bytes_in() == data.size());
+      assert(w.bytes_out() < data.size() && rix::io::path_size(p) == w.bytes_out());
+    }
+
+    rix::io::CompressedReader r{p, {.chunk_size = 1000}};
+    assert(r.codec() == codec);
+    std::size_t total = 0;
+    for (auto chunk = r.next(); !chunk.empty(); chunk = r.next())
+    {
+      assert(chunk.size() <= 1000);
+      assert(std::memcmp(chunk.data(), data.data() + total, chunk.size()) == 0);
+      total += chunk.size();
+    }
+    assert(total == data.size());
+
+    const auto whole = rix::io::read_file_decompressed(p);
+    assert(whole.size() == data.size() && std::memcmp(whole.data(), data.data(), data.size()) == 0);
+
+    // Single-byte and multi-block frames end cleanly too.
+    for (const std::size_t n : {std::size_t{1}, std::size_t{5} << 20})
+    {
+      std::vector<std::byte> sample(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        sample[i] = static_cast<std::byte>((i * 2654435761u) >> 13);
+      }
+      rix::io::write_file_compressed(p, sample, {.codec = codec});
+      assert(rix::io::read_file_decompressed(p) == sample);
+    }
+
+    // Concatenated frames decode as one stream.
+    const auto frame = rix::io::read_file_binary(p);
+    auto two = frame;
+    two.insert(two.end(), frame.begin(), frame.end());
+    rix::io::write_file_binary(p, two);
+    assert(rix::io::read_file_decompressed(p).size() == (std::size_t{10} << 20));
+
+    rix::io::write_file_compressed(p, data, {.codec = codec});
+
+    // Dropping the frame tail must be reported, not silently truncated.
+    const auto compressed = rix::io::read_file_binary(p);
+    rix::io::write_file_binary(p, std::span<const std::byte>(compressed).first(compressed.size() - 3));
+    bool truncated = false;
+    try
+    {
+      (void)rix::io::read_file_decompressed(p);
+    }
+    catch (const std::runtime_error &)
+    {
+      truncated = true;
+    }
+    assert(truncated);
+  }
+
+  rix::io::write_file_text(p, "plain text");
+  bool threw = false;
+  try
+  {
+    rix::io::CompressedReader r{p};
+  }
+  catch (const std::runtime_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  fs::remove(p);
+}
+
+static void test_directory_walker()
+{
+  const fs::path root = rix::io::temp_path("rix_io_walk");
+  fs::create_directories(root / "sub" / "deep");
+  fs::create_directories(root / "empty");
+  rix::io::write_file_text(root / "a.txt", "hello");
+  rix::io::write_file_text(root / "sub" / "b.bin", "0123456789");
+  rix::io::write_file_text(root / "sub" / "deep" / "c", "abc");
+  fs::create_symlink(root / "sub", root / "link");
+
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{4}})
+  {
+    std::mutex m;
+    std::vector<rix::io::DirEntry> seen;
+    const auto result = rix::io::walk_directory(root, [&](const rix::io::DirEntry &e)
+                                                {
+                                                  std::lock_guard<std::mutex> lock(m);
+                                                  seen.push_back(e); },
+                                                {.threads = threads});
+    assert(result.entries == 7 && result.errors == 0);
+    assert(seen.size() == 7);
+
+    std::uint64_t bytes = 0;
+    for (const auto &e : seen)
+    {
+      const auto rel = e.path.lexically_relative(root);
+      if (rel == "link")
+      {
+        assert(e.type == rix::io::EntryType::symlink);
+      }
+      else if (rel == "sub" || rel == "empty" || rel == fs::path("sub") / "deep")
+      {
+        assert(e.type == rix::io::EntryType::directory);
+      }
+      else
+      {
+        assert(e.type == rix::io::EntryType::regular);
+        bytes += e.size;
+      }
+      assert(e.depth == static_cast<std::size_t>(std::distance(rel.begin(), rel.end())) - 1);
+    }
+    assert(bytes == 5 + 10 + 3);
+  }
+
+  std::size_t shallow = 0;
+  (void)rix::io::walk_directory(root, [&](const rix::io::DirEntry &)
+                                { ++shallow; },
+                                {.threads = 1, .max_depth = 0});
+  assert(shallow == 4);
+
+  std::size_t pruned = 0;
+  (void)rix::io::walk_directory(root, [&](const rix::io::DirEntry &e)
+                                {
+                                  ++pruned;
+                                  return e.path.filename() != "sub"; },
+                                {.threads = 1});
+  assert(pruned == 4);
+
+  bool threw = false;
+  try
+  {
+    (void)rix::io::walk_directory(root / "missing", [](const rix::io::DirEntry &) {});
+  }
+  catch (const std::system_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try
+  {
+    (void)rix::io::walk_directory(root, [](const rix::io::DirEntry &)
+                                  { throw std::runtime_error("stop"); },
+                                  {.threads = 4});
+  }
+  catch (const std::runtime_error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  const std::vector<fs::path> paths{root / "a.txt", root / "missing", root / "sub", root / "link"};
+  for (const std::size_t threads : {std::size_t{1}, std::size_t{3}})
+  {
+    const auto stats = rix::io::stat_many(paths, {.threads = threads});
+    assert(stats.size() == 4);
+    assert(stats[0] && stats[0].type == rix::io::EntryType::regular && stats[0].size == 5);
+    assert(!stats[1] && stats[1].error == std::errc::no_such_file_or_directory);
+    assert(stats[2].type == rix::io::EntryType::directory);
+    assert(stats[3].type == rix::io::EntryType::directory);
+  }
+  const auto link = rix::io::stat_many(std::span<const fs::path>(paths).last(1), {.follow_symlinks = false});
+  assert(link[0].type == rix::io::EntryType::symlink);
+
+  fs::remove_all(root);
+}
+
+static void test_create_temp_file()
+{
+  std::vector<std::vector<fs::path>> names(4);
+  std::vector<std::thread> threads;
+  for (auto &list : names)
+  {
+    threads.emplace_back([&list]
+                         {
+                           for (int i = 0; i < 1000; ++i)
+                           {
+                             list.push_back(rix::io::temp_path("rix_io_uniq"));
+                           } });
+  }
+  for (auto &t : threads)
+  {
+    t.join();
+  }
+
+  std::vector<fs::path> all;
+  for (const auto &list : names)
+  {
+    all.insert(all.end(), list.begin(), list.end());
+  }
+  std::sort(all.begin(), all.end());
+  assert(std::adjacent_find(all.begin(), all.end()) == all.end());
+  assert(all.front().parent_path() == fs::temp_directory_path());
+  assert(all.front().extension() == ".tmp");
+
+  fs::path created;
+  {
+    rix::io::File f = rix::io::create_temp_file("rix_io_created");
+    created = f.path();
+    assert(f.is_open() && rix::io::path_exists(created));
+    assert(f.path().filename().string().rfind("rix_io_created_", 0) == 0);
+    f.write(std::string_view{"scratch"});
+    std::array<std::byte, 7> back{};
+    assert(f.read_at(0, back) == back.size());
+    assert(std::memcmp(back.data(), "scratch", back.size()) == 0);
+  }
+
+  bool exists = false;
+  try
+  {
+    rix::io::File again{created, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native,
+                        rix::io::FileFlags::exclusive};
+  }
+  catch (const std::system_error &e)
+  {
+    exists = e.code() == std::errc::file_exists;
+  }
+  assert(exists);
+  assert(rix::io::read_file_text(created) == "scratch");
+
+  fs::remove(created);
+}
+
+static void test_io_stats()
+{
+  rix::io::set_io_stats_callback({});
+  assert(!rix::io::publish_io_stats());
+
+  const fs::path p = rix::io::temp_path("rix_io_stats");
+  rix::io::set_io_stats_enabled(true);
+  rix::io::reset_io_stats();
+  {
+    rix::io::File f{p, rix::io::FileMode::write, rix::io::FileType::binary, rix::io::FileBackend::native};
+    f.write(std::string_view{"counted"});
+    f.sync();
+  }
+  {
+    rix::io::File f{p, rix::io::FileMode::read, rix::io::FileType::binary, rix::io::FileBackend::native};
+    assert(f.read_all_bytes().size() == 7);
+  }
+  rix::io::set_io_stats_enabled(false);
+
+  const auto s = rix::io::io_stats_snapshot();
+#if !defined(RIX_IO_NO_STATS)
+  assert(s.open.calls == 2);
+  assert(s.write.calls >= 1 && s.write.bytes == 7);
+  assert(s.read.calls >= 1 && s.read.bytes == 7);
+  assert(s.sync.calls == 1 && s.sync.errors == 0);
+
+  std::uint64_t bucketed = 0;
+  for (const auto n : s.read.latency_log2_ns)
+  {
+    bucketed += n;
+  }
+  assert(bucketed == s.read.calls);
+#endif
+
+  // Disabled: nothing more is recorded.
+  (void)rix::io::read_file_binary(p);
+  assert(rix::io::io_stats_snapshot().read.calls == s.read.calls);
+
+  std::uint64_t published = 0;
+  rix::io::set_io_stats_callback([&published](const rix::io::IoStatsSnapshot &snap)
+                                 { published = snap.write.bytes; });
+  assert(rix::io::publish_io_stats());
+  assert(published == s.write.bytes);
+  rix::io::set_io_stats_callback({});
+
+  rix::io::reset_io_stats();
+  assert(rix::io::io_stats_snapshot().open.calls == 0);
+  fs::remove(p);
+}
+
 int main()
 {
   test_buffer_text_roundtrip();
@@ -164,5 +1934,35 @@ int main()
   test_write_read_binary_helpers();
   test_file_mode_checks();
   test_try_read_helpers();
+  test_mapped_file();
+  test_native_backend();
+  test_read_all_text_sized_and_unsized();
+  test_read_into_buffer();
+  test_positional_io();
+  test_chunk_reader();
+  test_line_reader();
+  test_buffered_writer();
+  test_vectored_io();
+  test_path_copy();
+  test_async_io_context();
+  test_async_file_helpers();
+  test_read_files_binary();
+  test_allocator_aware_buffers();
+  test_uninitialized_buffer();
+  test_buffer_reader();
+  test_endian_encoding();
+  test_varint_encoding();
+  test_inline_buffer();
+  test_buffer_chain();
+  test_atomic_replace();
+  test_direct_io();
+  test_preallocate_and_punch_hole();
+  test_access_hints();
+  test_file_cache();
+  test_hashing();
+  test_compression();
+  test_directory_walker();
+  test_create_temp_file();
+  test_io_stats();
   return 0;
 }